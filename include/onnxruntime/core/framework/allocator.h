@@ -20,16 +20,27 @@ struct OrtArenaCfg {
                   initial_chunk_size_bytes(-1),
                   max_dead_bytes_per_chunk(-1),
                   initial_growth_chunk_size_bytes(-1),
-                  max_power_of_two_extend_bytes(-1) {}
+                  max_power_of_two_extend_bytes(-1),
+                  numa_interleave(-1),
+                  auto_shrink_hysteresis_bytes(-1),
+                  thread_local_magazine_bytes(-1),
+                  use_huge_pages(-1) {}
   OrtArenaCfg(size_t max_mem, int arena_extend_strategy, int initial_chunk_size_bytes,
               int max_dead_bytes_per_chunk, int initial_growth_chunk_size_bytes,
-              int64_t max_power_of_two_extend_bytes)
+              int64_t max_power_of_two_extend_bytes, int numa_interleave = -1,
+              int64_t auto_shrink_hysteresis_bytes = -1,
+              int64_t thread_local_magazine_bytes = -1,
+              int use_huge_pages = -1)
       : max_mem(max_mem),
         arena_extend_strategy(arena_extend_strategy),
         initial_chunk_size_bytes(initial_chunk_size_bytes),
         max_dead_bytes_per_chunk(max_dead_bytes_per_chunk),
         initial_growth_chunk_size_bytes(initial_growth_chunk_size_bytes),
-        max_power_of_two_extend_bytes(max_power_of_two_extend_bytes) {}
+        max_power_of_two_extend_bytes(max_power_of_two_extend_bytes),
+        numa_interleave(numa_interleave),
+        auto_shrink_hysteresis_bytes(auto_shrink_hysteresis_bytes),
+        thread_local_magazine_bytes(thread_local_magazine_bytes),
+        use_huge_pages(use_huge_pages) {}
 
   size_t max_mem;                         // use 0 to allow ORT to choose the default
   int arena_extend_strategy;              // use -1 to allow ORT to choose the default, 0 = kNextPowerOfTwo, 1 = kSameAsRequested
@@ -37,6 +48,19 @@ struct OrtArenaCfg {
   int max_dead_bytes_per_chunk;           // use -1 to allow ORT to choose the default
   int initial_growth_chunk_size_bytes;    // use -1 to allow ORT to choose the default
   int64_t max_power_of_two_extend_bytes;  // use -1 to allow ORT to choose the default
+  int numa_interleave;                    // 1 = interleave arena regions across NUMA nodes (Linux only),
+                                          // -1/0 = leave placement to first touch (default)
+  int64_t auto_shrink_hysteresis_bytes;   // > 0 enables automatic arena shrinkage: free regions are
+                                          // released once total allocation exceeds a decaying
+                                          // high-water mark of live bytes by more than this value.
+                                          // -1/0 = no automatic shrinkage (default)
+  int64_t thread_local_magazine_bytes;    // > 0 enables per-thread magazine caches of that many
+                                          // bytes in front of the arena, so hot-path small
+                                          // allocations skip the arena mutex.
+                                          // -1/0 = no magazines (default)
+  int use_huge_pages;                     // 1 = advise transparent huge page backing for large
+                                          // CPU extents and reserved slabs (Linux only).
+                                          // -1/0 = regular pages (default)
 };
 
 namespace onnxruntime {
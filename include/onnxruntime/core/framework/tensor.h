@@ -253,6 +253,18 @@ class Tensor final {
     return buffer_deleter_ != nullptr;
   }
 
+  /**
+   * Replace the data pointer of a tensor that does not own its buffer. Used by
+   * OrtValueTensorSlicer to advance a reusable slice view to the next position without
+   * reconstructing the Tensor and OrtValue per iteration. The new pointer must reference
+   * memory of at least SizeInBytes() valid for the tensor's existing type, shape and location.
+   * @warning this function is NOT thread-safe.
+   */
+  void SetDataRawForSliceView(void* p_data) {
+    ORT_ENFORCE(buffer_deleter_ == nullptr, "Only a non-owning tensor's data pointer can be replaced.");
+    p_data_ = p_data;
+  }
+
   /**
    * Resizes the tensor without touching underlying storage.
    * This requires the total size of the tensor to remains constant.
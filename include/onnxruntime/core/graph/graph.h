@@ -1350,6 +1350,10 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
     // Whether to set that no proto sync is required after resolving.
     // Useful for resolving right after loading from a GraphProto.
     bool no_proto_sync_required = false;
+    // Whether the model is treated as pre-validated (see ModelOptions::trusted_model): ONNX
+    // schema checking and type/shape inference are skipped and recorded type/shape metadata is
+    // used as-is. Graph connectivity, topological ordering and schema binding still happen.
+    bool trusted_model = false;
   };
 
   /**
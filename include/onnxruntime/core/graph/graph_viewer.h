@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 
 #pragma once
+
+#include <mutex>
 #include <unordered_set>
 #include <filesystem>
 
@@ -189,6 +191,13 @@ class GraphViewer {
   */
   const IndexedSubGraph* GetFilterInfo() const { return filter_info_; }
 
+  /** Get the indices of all nodes with the given op type, in topological order.
+  Built lazily on first use and cached (the viewer's node set is immutable), so transformers
+  and EP GetCapability passes that repeatedly scan for specific op types stop walking the
+  whole graph per lookup. Returns an empty span for op types not present.
+  */
+  gsl::span<const NodeIndex> GetNodesByOpType(const std::string& op_type) const;
+
 #if !defined(ORT_MINIMAL_BUILD)
   IOnnxRuntimeOpSchemaCollectionPtr GetSchemaRegistry() const { return graph_->GetSchemaRegistry(); }
 #endif
@@ -200,6 +209,11 @@ class GraphViewer {
   }
 
  private:
+  // lazily built op type -> node indices (topological order) cache for GetNodesByOpType.
+  // mutable + once_flag as the viewer is logically immutable.
+  mutable std::once_flag op_type_index_once_;
+  mutable std::unordered_map<std::string, std::vector<NodeIndex>> op_type_to_nodes_;
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(GraphViewer);
   GraphViewer(const Graph& graph, const IndexedSubGraph* filter_info);
 
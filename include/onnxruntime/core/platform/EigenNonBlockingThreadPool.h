@@ -1535,9 +1535,14 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
 
     assert(td.GetStatus() == WorkerData::ThreadStatus::Spinning);
 
-    constexpr int log2_spin = 20;
-    const int spin_count = allow_spinning_ ? (1ull << log2_spin) : 0;
-    const int steal_count = spin_count / 100;
+    // Adaptive spin budget: each time spinning pays off before the budget runs out the budget
+    // grows, and each time the worker ends up blocking anyway it shrinks. The budget then
+    // tracks the workload's task inter-arrival pattern - long spins inside a burst of short
+    // parallel regions, quick parking between bursty requests - instead of burning a fixed
+    // 2^20 pause iterations either way.
+    constexpr int kMinLog2Spin = 12;
+    constexpr int kMaxLog2Spin = 20;
+    int log2_spin = kMaxLog2Spin;
 
     SetDenormalAsZero(set_denormal_as_zero_);
     profiler_.LogThreadId(thread_id);
@@ -1545,6 +1550,8 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     while (!should_exit) {
       Task t = q.PopFront();
       if (!t) {
+        const int spin_count = allow_spinning_ ? (1 << log2_spin) : 0;
+        const int steal_count = std::max(1, spin_count / 100);
         // Spin waiting for work.
         for (int i = 0; i < spin_count && !done_; i++) {
           if (((i + 1) % steal_count == 0)) {
@@ -1552,7 +1559,10 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
           } else {
             t = q.PopFront();
           }
-          if (t) break;
+          if (t) {
+            log2_spin = std::min(kMaxLog2Spin, log2_spin + 1);
+            break;
+          }
 
           if (spin_loop_status_.load(std::memory_order_relaxed) == SpinLoopStatus::kIdle) {
             break;
@@ -1562,6 +1572,8 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
 
         // Attempt to block
         if (!t) {
+          // the whole budget was spent without finding work: shrink it
+          log2_spin = std::max(kMinLog2Spin, log2_spin - 1);
           if (!td.SetBlocked(  // Pre-block test
                   [&]() -> bool {
                     bool should_block = true;
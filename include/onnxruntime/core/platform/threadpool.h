@@ -19,6 +19,7 @@ limitations under the License.
 #include <string>
 #include <vector>
 #include <functional>
+#include <atomic>
 #include <memory>
 #include "core/common/common.h"
 #include "core/platform/env.h"
@@ -360,6 +361,30 @@ class ThreadPool {
   // working in combination with the thread initiating the loop.
   static int DegreeOfParallelism(const ThreadPool* tp);
 
+  // Nested-parallelism bridge: while N graph-level (inter-op) tasks are concurrently fanning
+  // loops onto this pool, each ParallelFor divides its degree of parallelism by N, so
+  // concurrent tasks share the workers instead of oversubscribing the machine. The
+  // Begin/End calls are made by the stream executor around inter-op task bodies.
+  static void BeginNestedRegion(ThreadPool* tp) {
+    if (tp) tp->nested_regions_.fetch_add(1, std::memory_order_relaxed);
+  }
+  static void EndNestedRegion(ThreadPool* tp) {
+    if (tp) tp->nested_regions_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // RAII form of Begin/EndNestedRegion, exception safe. Used around every concurrently
+  // executing graph-level task (initial stream launches and downstream continuations alike) so
+  // the divisor counts them all.
+  class NestedRegionScope {
+   public:
+    explicit NestedRegionScope(ThreadPool* pool) : pool_(pool) { BeginNestedRegion(pool_); }
+    ~NestedRegionScope() { EndNestedRegion(pool_); }
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(NestedRegionScope);
+
+   private:
+    ThreadPool* pool_;
+  };
+
   ORT_DISALLOW_COPY_AND_ASSIGNMENT(ThreadPool);
 
   // StartProfiling and StopProfiling are not to be consumed as public-facing API
@@ -428,6 +453,9 @@ class ThreadPool {
 
   // Force the thread pool to run in hybrid mode on a normal cpu.
   bool force_hybrid_ = false;
+
+  // count of concurrently active graph-level tasks fanning onto this pool (see BeginNestedRegion)
+  std::atomic<int> nested_regions_{0};
 };
 
 }  // namespace concurrency
@@ -13,6 +13,7 @@
 #include "core/common/status.h"
 #include "core/framework/allocator.h"
 #include "core/framework/execution_provider.h"
+#include "core/framework/shared_initializer_pool.h"
 #include "core/platform/device_discovery.h"
 #include "core/platform/threadpool.h"
 
@@ -88,6 +89,14 @@ class Environment {
     return shared_allocators_;
   }
 
+  /**
+   * Returns the pool used to deduplicate byte-identical constant initializers across sessions
+   * created from this environment (see session.cross_session_initializer_sharing).
+   */
+  SharedInitializerPool& GetSharedInitializerPool() const {
+    return *shared_initializer_pool_;
+  }
+
   /**
    * Removes registered allocator that was previously registered for sharing between multiple sessions.
    */
@@ -133,6 +142,9 @@ class Environment {
   std::unique_ptr<onnxruntime::concurrency::ThreadPool> inter_op_thread_pool_;
   bool create_global_thread_pools_{false};
   std::vector<AllocatorPtr> shared_allocators_;
+  // unique_ptr so the (mutex-holding) pool keeps a stable address; mutable state is internal.
+  std::unique_ptr<SharedInitializerPool> shared_initializer_pool_ =
+      std::make_unique<SharedInitializerPool>();
 
 #if !defined(ORT_MINIMAL_BUILD)
   // register EPs that are built into the ORT binary so they can take part in AutoEP selection
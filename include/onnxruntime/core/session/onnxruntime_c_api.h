@@ -2881,6 +2881,18 @@ struct OrtApi {
    *  Use -1 to allow ORT to choose the default 1GB for max_power_of_two_extend_bytes.
    *  Ultimately, the allocation size is determined by the allocation memory request.
    *  Further allocation sizes are governed by the arena extend strategy.
+   * "numa_interleave": If 1, freshly extended CPU arena regions are interleaved across NUMA nodes
+   *  (Linux only, best effort). Defaults to 0 (placement left to first touch).
+   * "auto_shrink_hysteresis_bytes": If > 0, the arena automatically releases fully-free regions
+   *  once total allocation exceeds a decaying high-water mark of live bytes by more than this
+   *  value, so occasional large requests stop pinning memory. Defaults to 0 (no automatic
+   *  shrinkage; use the run option to shrink explicitly).
+   * "thread_local_magazine_bytes": If > 0, each thread keeps up to this many bytes of small freed
+   *  blocks in a local magazine and serves repeat allocations of the same size from it without
+   *  taking the arena mutex. Defaults to 0 (no magazines).
+   * "use_huge_pages": If 1, large CPU arena extents and reserved slabs (16MB and above) are
+   *  advised for transparent huge page backing (Linux only, best effort); the advised byte count
+   *  is reported through the allocator stats. Defaults to 0 (regular pages).
    *
    * \param[in] arena_config_keys Keys to configure the arena
    * \param[in] arena_config_values Values to configure the arena
@@ -46,6 +46,19 @@ static const char* const kOrtRunOptionsConfigQnnRpcControlLatency = "qnn.rpc_con
 // Set QNN Lora Config File for apply Lora in QNN context binary
 static const char* const kOrtRunOptionsConfigQnnLoraConfig = "qnn.lora_config";
 
+// Priority of this Run for cooperative scheduling when latency-critical and batch traffic share
+// one process: "high", "normal" (default) or "low". While a high-priority Run is in flight,
+// threads driving low-priority Runs yield between node dispatches so the interactive Run's
+// kernels get the cores. Effective for CPU execution; normal-priority Runs are never paused.
+static const char* const kOrtRunOptionsConfigRunPriority = "run.priority";
+
+// If "1" and the session enables session.iobinding_output_pool_capacity, a Run with an IO
+// binding first moves the binding's current outputs into its recycling pool - the caller
+// thereby declares it is done reading them - and this Run's device-bound outputs reuse pooled
+// buffers whose shape and device match instead of allocating. "0" (default) leaves outputs
+// untouched.
+static const char* const kOrtRunOptionsConfigRecycleIOBindingOutputs = "run.recycle_iobinding_outputs";
+
 // Set graph annotation id for CUDA EP. Use with enable_cuda_graph=true.
 // The value should be an integer. If the value is not set, the default value is 0 and
 // ORT session only captures one cuda graph before another capture is requested.
@@ -364,3 +364,131 @@ static const char* const kOrtEpDynamicOptionsWorkloadType = "ep.dynamic.workload
 // - "0": EP compile is not disabled. [DEFAULT]
 // - "1": EP compile is disabled.
 static const char* const kOrtSessionOptionsDisableModelCompile = "session.disable_model_compile";
+
+// Path to a file used to persist the finalized execution plan's buffer reuse decisions across
+// process restarts. When set, session initialization attempts to load the cached plan and, if the
+// artifact's model hash matches the loaded model, the memory reuse analysis is skipped. When the
+// artifact is missing or stale it is (re)written after planning completes.
+// The artifact is only consulted for the main graph in non-parallel execution mode.
+// If unset (default), no plan caching is performed.
+static const char* const kOrtSessionOptionsExecutionPlanCachePath = "session.execution_plan_cache_path";
+
+// Directory for a disk-backed cache of pre-packed weights, used together with a
+// PrepackedWeightsContainer (see CreatePrepackedWeightsContainer). When set, pre-packed buffers
+// computed by one process are persisted and memory-mapped read-only by later sessions/processes,
+// so cold start skips packing and N workers on a machine share one physical copy per weight.
+// Cache entries are keyed by the pre-packed buffer hash plus the CPU-feature identity that
+// selects the kernel dispatch, so a hardware change invalidates them naturally.
+// If unset (default), pre-packed weights are only shared in-memory within the process.
+static const char* const kOrtSessionOptionsPrepackedWeightsCacheDir = "session.prepacked_weights_cache_dir";
+
+// Maximum number of threads used to fan out kernel construction and initializer deserialization
+// during session initialization. The work is scheduled on the inter-op thread pool when one is
+// available, falling back to the intra-op pool. "0" (default) keeps initialization single
+// threaded; values larger than the pool size are capped by the pool.
+static const char* const kOrtSessionOptionsParallelInitializeDegree = "session.parallel_initialize_degree";
+
+// If "1", session state for If/Loop/Scan subgraphs is not built during Initialize(); each
+// subgraph's planning, kernel creation and initializer loading happen when the owning
+// control-flow node first executes. This cuts startup time and memory for models with many
+// rarely-taken branches, at the cost of a one-time latency hit on the first Run that reaches
+// each subgraph. "0" (default) keeps eager construction.
+static const char* const kOrtSessionOptionsLazySubgraphSessionState = "session.lazy_subgraph_session_state";
+
+// If "1", byte-identical constant initializers are deduplicated across all sessions created from
+// the same environment: the first session to load a weight provides the canonical buffer and
+// later sessions alias it (content-hash keyed, memcmp verified). Only CPU raw-data initializers
+// participate; they are allocated individually rather than in the session's weights slab so the
+// shared copy can outlive any one session. Canonical copies are retained for the environment's
+// lifetime. "0" (default) keeps per-session copies.
+static const char* const kOrtSessionOptionsCrossSessionInitializerSharing =
+    "session.cross_session_initializer_sharing";
+
+// If "1", the model is loaded as trusted: ONNX schema checking and type/shape inference are
+// skipped during Graph::Resolve and the type/shape metadata recorded in the model is used as-is.
+// Graph connectivity, topological ordering and kernel/schema binding still run. Only use for
+// models that were fully validated when they were produced (e.g. at build time) and are shipped
+// read-only; the model must contain complete type/shape metadata, such as one saved via
+// optimized_model_filepath. "0" (default) keeps full re-validation.
+static const char* const kOrtSessionOptionsTrustedModelLoad = "session.trusted_model_load";
+
+// Bucket size for shape-bucketed memory pattern planning. When set to N > 1, dynamic input
+// dimensions are rounded up to the next multiple of N when looking up / generating memory
+// patterns, so runs whose shapes fall in the same bucket share a single pre-computed allocation
+// plan sized for the bucket ceiling (e.g. sequence lengths 33..64 with N=32). Costs up to
+// (N-1)/N of over-allocation on bucketed dims in exchange for pattern hits on dynamic-shape
+// models. "0" (default) keeps exact-shape patterns.
+static const char* const kOrtSessionOptionsMemoryPatternShapeBucketSize =
+    "session.memory_pattern_shape_bucket_size";
+
+// Cap (in MB) for per-thread reusable scratch buffers serving temporary CPU kernel workspace
+// through OpKernelContext::GetTempSpaceAllocator. When set to N > 0, each worker thread keeps
+// one block (grown to its high-water workspace demand, at most N MB) that is bump-allocated and
+// rewound as kernels release their temp buffers, so hot-path workspace allocations skip the
+// shared arena and its lock entirely. Oversized requests fall through to the regular allocator.
+// "0" (default) disables the scratch layer.
+static const char* const kOrtSessionOptionsReusableScratchBufferMaxMb =
+    "session.reusable_scratch_buffer_max_mb";
+
+// Minimum gap, in topological node positions, between uses of a CPU activation before the
+// planner assigns it to the session's secondary file-backed allocator. Pages of such tensors
+// can be written back and reclaimed by the OS while cold (no swap needed) and are faulted back
+// in when the consuming node runs, lowering peak RSS for long-context batch inference. Values
+// whose buffers are reused by other values are never offloaded. "0" (default) disables
+// offloading.
+static const char* const kOrtSessionOptionsOffloadMinDefUseGapNodes =
+    "session.offload_min_def_use_gap_nodes";
+
+// Directory for the temporary files backing offloaded activations (see
+// session.offload_min_def_use_gap_nodes). It must be on a disk-backed filesystem: on tmpfs
+// (notably /tmp on mainstream Linux distros) the mapping degenerates to swap-backed anonymous
+// memory and pages cannot be written back to disk. If unset, falls back to the platform
+// temporary directory as a last resort.
+static const char* const kOrtSessionOptionsOffloadDirectory = "session.offload_directory";
+
+// If "1", every kernel execution updates a per-node histogram of log2(duration in
+// microseconds): two atomic operations and a subtraction of steady_clock reads per node, cheap
+// enough to leave enabled in production. Read the counters between Runs via
+// SessionState::GetNodeDurationHistogram to localize latency regressions to nodes without
+// attaching a profiler. "0" (default) collects nothing.
+static const char* const kOrtSessionOptionsCollectNodeDurationHistograms =
+    "session.collect_node_duration_histograms";
+
+// Threshold (in microseconds) for adaptive per-node intra-op parallelism. When set to N > 0,
+// the executor measures each node's execution time (exponential moving average); nodes that
+// complete in under N microseconds are handed a null intra-op pool and run single threaded,
+// since for them the parallel-For fan-out/synchronization overhead exceeds the work (e.g. small
+// GEMMs spreading over 32 threads). Unmeasured nodes start parallel, and a 2x hysteresis band
+// keeps decisions from oscillating. "0" (default) disables the adaptation.
+static const char* const kOrtSessionOptionsAdaptiveIntraOpThresholdUs =
+    "session.adaptive_intra_op_threshold_us";
+
+// Path of a cross-process cache for the optimized graph. On session load, if the file exists it
+// is loaded in place of the original model with graph transformers disabled (its optimizations
+// are already baked in); if it doesn't, the original model is loaded and the optimized graph is
+// written there during Initialize (same machinery as optimized_model_filepath). Later processes
+// loading the same model then skip the transformer passes entirely. The caller owns
+// invalidation: remove the file when the original model or the ORT version changes.
+// If unset (default), no optimized-graph caching is performed.
+static const char* const kOrtSessionOptionsOptimizedModelCachePath = "session.optimized_model_cache_path";
+
+// If "1", after session initialization one INFO log line per node records the kernel that was
+// actually selected (node name, op, assigned execution provider, kernel registration and its
+// since-version range), so kernel dispatch can be inspected and diffed across builds or EP
+// configurations without a debugger. "0" (default) logs nothing.
+static const char* const kOrtSessionOptionsLogKernelDispatch = "session.log_kernel_dispatch";
+
+// If "1", Initialize() logs one INFO line per major startup phase (graph transforms + resolve,
+// session state finalization - which covers partitioning, planning, kernel creation,
+// initializer loading and prepacking - and overall completion) with cumulative elapsed
+// milliseconds, so cold-start regressions localize to a phase from fleet logs. "0" (default)
+// logs nothing.
+static const char* const kOrtSessionOptionsLogStartupPhases = "session.log_startup_phases";
+
+// Number of previously produced output buffers retained per output name by IO bindings created
+// from this session, for reuse across Runs with varying output shapes. A value > 0 enables the
+// pool; together with the run.recycle_iobinding_outputs run option, a device-bound output whose
+// shape and device match a retained buffer reuses it instead of allocating. "0" (default)
+// disables the pool.
+static const char* const kOrtSessionOptionsIOBindingOutputPoolCapacity =
+    "session.iobinding_output_pool_capacity";
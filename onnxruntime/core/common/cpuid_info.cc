@@ -127,15 +127,18 @@ void CPUIDInfo::X86Init() {
         GetCPUID(7, data);
         const uint32_t max_SubLeaves = data[0];
         has_amx_bf16_ = (data[3] & (1 << 22));
+        has_amx_int8_ = (data[3] & (1 << 25));
         has_avx2_ = has_avx_ && (data[1] & (1 << 5));
         has_avx512f_ = has_avx512 && (data[1] & (1 << 16));
         // Add check for AVX512 Skylake since tensorization GEMM need intrinsics from avx512bw/avx512dq.
         // avx512_skylake = avx512f | avx512vl | avx512cd | avx512bw | avx512dq
         has_avx512_skylake_ = has_avx512 && (data[1] & ((1 << 16) | (1 << 17) | (1 << 28) | (1 << 30) | (1 << 31)));
+        has_avx512_vnni_ = has_avx512 && (data[2] & (1 << 11));
         is_hybrid_ = (data[3] & (1 << 15));
         if (max_SubLeaves >= 1) {
           GetCPUID(7, 1, data);
           has_avx512_bf16_ = has_avx512 && (data[0] & (1 << 5));
+          has_avx_vnni_ = has_avx_ && (data[0] & (1 << 4));
         }
       }
     }
@@ -417,6 +417,11 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
   }
 
   auto d_of_p = DegreeOfParallelism(this);
+  // concurrent graph-level tasks share the pool instead of each fanning out to every worker
+  const int nested_regions = nested_regions_.load(std::memory_order_relaxed);
+  if (nested_regions > 1) {
+    d_of_p = std::max<decltype(d_of_p)>(1, d_of_p / nested_regions);
+  }
   if (thread_options_.dynamic_block_base_ <= 0) {
     // Split the work across threads in the pool.  Each work item will run a loop claiming iterations,
     // hence we need at most one for each thread, even if the number of blocks of iterations is larger.
@@ -426,11 +431,17 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
     assert(num_work_items > 0);
 
     LoopCounter lc(total, d_of_p, block_size);
+    // When a worker has drained its home shard and starts claiming from other shards it is, by
+    // definition, helping a straggler. Claim at finer granularity there so the remaining
+    // iterations of a slow shard (e.g. one whose worker lost its core to the OS) are spread
+    // over all helpers instead of being taken in a few large chunks.
+    const std::ptrdiff_t steal_block_size = std::max<std::ptrdiff_t>(1, block_size / TaskGranularityFactor);
     std::function<void(unsigned)> run_work = [&](unsigned idx) {
       unsigned my_home_shard = lc.GetHomeShard(idx);
       unsigned my_shard = my_home_shard;
       uint64_t my_iter_start, my_iter_end;
-      while (lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end, block_size)) {
+      while (lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end,
+                                my_shard == my_home_shard ? block_size : steal_block_size)) {
         fn(static_cast<std::ptrdiff_t>(my_iter_start),
            static_cast<std::ptrdiff_t>(my_iter_end));
       }
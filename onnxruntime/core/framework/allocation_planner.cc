@@ -19,6 +19,7 @@
 #include "core/framework/kernel_def_builder.h"
 #include "core/framework/mldata_type_utils.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/session_plan_cache.h"
 #include "core/framework/session_state.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
@@ -1497,6 +1498,34 @@ class PlannerImpl {
 #endif
 
   Status ComputeReusePlan() {
+    // Replay previously computed reuse decisions when a valid plan cache artifact was loaded.
+    // Only the single stream case is replayed: the multi-stream path additionally rewrites
+    // decisions in OptimizeReusePlanForMultiStream based on runtime stream state.
+    if (const CachedReusePlan* cached = context_->GetCachedReusePlan();
+        cached != nullptr && !cached->Empty() && IsSingleStream() &&
+        cached->values.size() == ort_value_info_.size()) {
+      for (size_t i = 0; i < cached->values.size(); ++i) {
+        auto& per_value = AllocPlan(static_cast<OrtValueIndex>(i));
+        // Inputs and weights were already planned in ComputePlanForInputsAndWeights;
+        // only the activation decisions the reuse analysis would make are replayed.
+        if (per_value.alloc_kind == AllocKind::kNotSet) {
+          per_value.alloc_kind = cached->values[i].alloc_kind;
+          per_value.reused_buffer = cached->values[i].reused_buffer;
+        }
+      }
+      // The skipped reuse walk is also where activations get their value_type
+      // (ExecutionFrame refuses to allocate without it), so set it here the same
+      // way the walk does.
+      for (auto node_index : graph_viewer_.GetNodesInTopologicalOrder()) {
+        const auto* pnode = graph_viewer_.GetNode(node_index);
+        for (const auto* node_output : pnode->OutputDefs()) {
+          if (!node_output->Exists()) continue;
+          AllocPlan(Index(node_output->Name())).value_type = utils::GetMLDataType(*node_output);
+        }
+      }
+      return Status::OK();
+    }
+
     gsl::not_null<const ISequentialPlannerContext*> backup_context = context_;
     SequentialPlannerContext no_mem_reuse_context(ExecutionMode::ORT_PARALLEL, ExecutionOrder::DEFAULT, false);
     if (!IsSingleStream()) {
@@ -1817,6 +1846,89 @@ class PlannerImpl {
   }
 
   // Compute allocation order for tensors that are required to be allocated contiguously.
+  // Assigns CPU activations whose uses are far apart in the execution order to the secondary
+  // (file-backed) allocator so their pages can be reclaimed while cold. Values that are reused
+  // by other values stay on the primary allocator: their buffer must remain hot.
+  void ComputeSecondaryAllocatorAssignments() {
+    const int min_gap = context_->GetOffloadMinDefUseGap();
+    if (min_gap <= 0) {
+      return;
+    }
+
+    // topological position of every node
+    InlinedHashMap<NodeIndex, int> topo_position;
+    {
+      int position = 0;
+      for (NodeIndex node_index : graph_viewer_.GetNodesInTopologicalOrder()) {
+        topo_position[node_index] = position++;
+      }
+    }
+
+    // def position and sorted use positions per OrtValue
+    const int num_values = ort_value_name_idx_map_.MaxIdx() + 1;
+    std::vector<int> def_position(num_values, -1);
+    std::vector<InlinedVector<int>> use_positions(num_values);
+
+    for (NodeIndex node_index : graph_viewer_.GetNodesInTopologicalOrder()) {
+      const Node* node = graph_viewer_.GetNode(node_index);
+      const int position = topo_position[node_index];
+
+      auto record_use = [&](const NodeArg& arg, size_t /*idx*/) {
+        if (arg.Exists()) {
+          int value_idx = -1;
+          if (ort_value_name_idx_map_.GetIdx(arg.Name(), value_idx).IsOK()) {
+            use_positions[value_idx].push_back(position);
+          }
+        }
+        return Status::OK();
+      };
+      ORT_IGNORE_RETURN_VALUE(Node::ForEachWithIndex(node->InputDefs(), record_use));
+      ORT_IGNORE_RETURN_VALUE(Node::ForEachWithIndex(node->ImplicitInputDefs(), record_use));
+
+      for (const auto* output : node->OutputDefs()) {
+        if (output->Exists()) {
+          int value_idx = -1;
+          if (ort_value_name_idx_map_.GetIdx(output->Name(), value_idx).IsOK()) {
+            def_position[value_idx] = position;
+          }
+        }
+      }
+    }
+
+    // values reused by others must stay hot for their whole lifetime
+    std::vector<bool> is_reused(num_values, false);
+    for (int i = 0; i < num_values; ++i) {
+      const auto& per_value = plan_.allocation_plan[i];
+      if (per_value.alloc_kind == AllocKind::kReuse || per_value.alloc_kind == AllocKind::kShare) {
+        if (per_value.reused_buffer >= 0 && per_value.reused_buffer < num_values) {
+          is_reused[per_value.reused_buffer] = true;
+        }
+      }
+    }
+
+    for (int i = 0; i < num_values; ++i) {
+      auto& per_value = plan_.allocation_plan[i];
+      if (per_value.alloc_kind != AllocKind::kAllocate ||
+          per_value.location.Type() != OrtDevice::CPU ||
+          is_reused[i] || def_position[i] < 0 || use_positions[i].empty()) {
+        continue;
+      }
+
+      int max_gap = 0;
+      int previous = def_position[i];
+      for (int use : use_positions[i]) {
+        if (use > previous) {
+          max_gap = std::max(max_gap, use - previous);
+          previous = use;
+        }
+      }
+
+      if (max_gap >= min_gap) {
+        per_value.use_secondary_allocator = true;
+      }
+    }
+  }
+
   Status ComputeAllocationOrder() {
     for (auto& stream : stream_nodes_) {
       std::vector<OrtValueIndex>& initializer_allocation_order(plan_.initializer_allocation_order);
@@ -2197,6 +2309,55 @@ class PlannerImpl {
       }
     }
 
+#ifndef ENABLE_TRAINING
+    // fuse runs of consecutive kernel launches (no barriers/notifications in between) into one
+    // step, so chains of cheap nodes pay the step dispatch and bookkeeping once per chain.
+    // plan_.downstream_map records absolute step indices, so those are remapped alongside.
+    // Training builds keep one step per node: partial graph execution slices streams by step
+    // index against the toposort order (see PartialGraphExecutionState).
+    for (size_t i = 0; i < num_logic_streams_; ++i) {
+      auto& steps = execution_plan[i]->steps_;
+      InlinedVector<std::unique_ptr<SequentialExecutionPlan::ExecutionStep>> fused_steps;
+      fused_steps.reserve(steps.size());
+      InlinedVector<int> old_to_new(steps.size(), 0);
+
+      size_t step_idx = 0;
+      while (step_idx < steps.size()) {
+        if (!steps[step_idx]->IsLaunchKernelStep()) {
+          old_to_new[step_idx] = static_cast<int>(fused_steps.size());
+          fused_steps.push_back(std::move(steps[step_idx]));
+          ++step_idx;
+          continue;
+        }
+
+        size_t run_end = step_idx;
+        InlinedVector<NodeIndex> run_nodes;
+        while (run_end < steps.size() && steps[run_end]->IsLaunchKernelStep()) {
+          old_to_new[run_end] = static_cast<int>(fused_steps.size());
+          run_nodes.push_back(steps[run_end]->GetNodeIndex());
+          ++run_end;
+        }
+
+        if (run_nodes.size() > 1) {
+          fused_steps.push_back(std::make_unique<LaunchKernelGroupStep>(std::move(run_nodes)));
+        } else {
+          fused_steps.push_back(std::move(steps[step_idx]));
+        }
+        step_idx = run_end;
+      }
+
+      for (auto& downstream_entry : plan_.downstream_map) {
+        for (auto& stream_and_step : downstream_entry.second) {
+          if (stream_and_step.first == i) {
+            stream_and_step.second = old_to_new[stream_and_step.second];
+          }
+        }
+      }
+
+      steps = std::move(fused_steps);
+    }
+#endif  // !ENABLE_TRAINING
+
     for (auto node_index : graph_viewer_.GetNodesInTopologicalOrder(context_->GetExecutionOrder())) {
       auto* node = graph_viewer_.GetNode(node_index);
       const auto& output_defs = node->OutputDefs();
@@ -2385,6 +2546,8 @@ Status PlannerImpl::CreatePlan(
   // convert information in the freelist_ into a deallocation plan in required format
   ORT_RETURN_IF_ERROR(GenerateDeallocationPlan());
 
+  ComputeSecondaryAllocatorAssignments();
+
   // generate program counter
 #ifdef ENABLE_TRAINING
   ORT_RETURN_IF_ERROR(CalculateProgramCounter());
@@ -2606,6 +2769,128 @@ void DeviceBasedPartitioner::SaveConfig() const {
   }
 }
 
+/*
+BranchBasedPartitioner - splits independent CPU branches into separate logical streams so the
+stream executor overlaps them on the inter-op pool. Nodes fed only by graph inputs/initializers
+start new streams (up to "max_streams", round robin beyond that); a node consuming from a single
+stream joins it; a node merging several branches joins the first and synchronizes with the rest
+through the plan's existing cross-stream notification steps. Nodes on non-CPU devices keep the
+device-per-stream grouping of DeviceBasedPartitioner.
+
+Config file example:
+{
+  "type": "BranchBasedPartitioner",
+  "max_streams": 4
+}
+*/
+class BranchBasedPartitioner : public IGraphPartitioner {
+ public:
+  BranchBasedPartitioner(const logging::Logger& logger, const PathString& config_file)
+      : IGraphPartitioner(logger, config_file) {
+    if (!config_file.empty()) {
+      std::ifstream if_stream(config_file);
+      if (if_stream.is_open()) {
+        try {
+          json json_config = json::parse(if_stream);
+          if (json_config.contains("max_streams")) {
+            max_streams_ = std::max<size_t>(1, json_config["max_streams"].get<size_t>());
+          }
+        } catch (const std::exception& ex) {
+          LOGS(logger_, WARNING) << "Caught exception when reading partition config file: " << ex.what();
+        }
+      }
+    }
+  }
+
+  Status PartitionGraph(const onnxruntime::GraphViewer& graph_viewer,
+                        const ExecutionProviders& execution_providers,
+                        std::vector<InlinedVector<NodeIndex>>& stream_nodes,
+                        ExecutionOrder execution_order) override;
+
+  const char* Type() const override { return "BranchBasedPartitioner"; }
+
+  size_t Streams() const override { return num_streams_; }
+
+ private:
+  size_t max_streams_ = 4;
+  size_t num_streams_ = 0;
+};
+
+Status BranchBasedPartitioner::PartitionGraph(const onnxruntime::GraphViewer& graph_viewer,
+                                              const ExecutionProviders& execution_providers,
+                                              std::vector<InlinedVector<NodeIndex>>& stream_nodes,
+                                              ExecutionOrder execution_order) {
+  const auto& p_graph_nodes = graph_viewer.GetNodesInTopologicalOrder(execution_order);
+
+  stream_nodes.clear();
+  // stream index per node; non-CPU devices keep one stream each, appended after the CPU ones
+  InlinedHashMap<NodeIndex, size_t> node_to_stream;
+  InlinedHashMap<OrtDevice::DeviceType, size_t> device_to_stream;
+  size_t num_cpu_streams = 0;
+  size_t next_round_robin = 0;
+
+  auto cpu_stream_count = [&]() { return num_cpu_streams; };
+
+  for (auto node_index : p_graph_nodes) {
+    const auto* node = graph_viewer.GetNode(node_index);
+    auto* ep = execution_providers.Get(*node);
+    const auto device_type = ep->GetOrtDeviceByMemType(OrtMemType::OrtMemTypeDefault).Type();
+
+    if (device_type != OrtDevice::CPU) {
+      auto it = device_to_stream.find(device_type);
+      if (it == device_to_stream.end()) {
+        stream_nodes.push_back({});
+        it = device_to_stream.emplace(device_type, stream_nodes.size() - 1).first;
+      }
+      node_to_stream[node_index] = it->second;
+      stream_nodes[it->second].push_back(node_index);
+      continue;
+    }
+
+    // first CPU-stream producer feeding this node determines its stream
+    size_t stream = std::numeric_limits<size_t>::max();
+    for (auto producer_it = node->InputNodesBegin(); producer_it != node->InputNodesEnd(); ++producer_it) {
+      auto producer_stream = node_to_stream.find(producer_it->Index());
+      if (producer_stream != node_to_stream.end() && producer_stream->second < cpu_stream_count()) {
+        stream = producer_stream->second;
+        break;
+      }
+    }
+
+    if (stream == std::numeric_limits<size_t>::max()) {
+      // branch root: fed only by graph inputs/initializers (or non-CPU producers)
+      if (num_cpu_streams < max_streams_) {
+        // CPU streams occupy the low indices; insert before any device streams
+        stream = num_cpu_streams++;
+        if (stream == stream_nodes.size()) {
+          stream_nodes.push_back({});
+        } else {
+          stream_nodes.insert(stream_nodes.begin() + stream, {});
+          // device streams shifted by one
+          for (auto& entry : device_to_stream) {
+            ++entry.second;
+          }
+          for (auto& entry : node_to_stream) {
+            if (entry.second >= stream) {
+              ++entry.second;
+            }
+          }
+        }
+      } else {
+        stream = next_round_robin++ % num_cpu_streams;
+      }
+    }
+
+    node_to_stream[node_index] = stream;
+    stream_nodes[stream].push_back(node_index);
+  }
+
+  num_streams_ = stream_nodes.size();
+  LOGS(logger_, INFO) << "BranchBasedPartitioner created " << num_cpu_streams << " CPU stream(s), "
+                      << (num_streams_ - num_cpu_streams) << " device stream(s).";
+  return Status::OK();
+}
+
 std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(const logging::Logger& logger,
                                                                              const PathString& config_file) {
   // use device based partitioner by default
@@ -2620,6 +2905,8 @@ std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(con
           auto type = json_config["type"];
           if (type == "DeviceBasedPartitioner") {
             partitioner_type = IGraphPartitioner::GraphPartitioningStrategy::DeviceBasedPartition;
+          } else if (type == "BranchBasedPartitioner") {
+            partitioner_type = IGraphPartitioner::GraphPartitioningStrategy::BranchBasedPartition;
           }
         }
       } catch (const std::exception& ex) {
@@ -2628,6 +2915,10 @@ std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(con
       f.close();
     }
   }
+  if (partitioner_type == IGraphPartitioner::GraphPartitioningStrategy::BranchBasedPartition) {
+    LOGS(logger, INFO) << "Use BranchBasedPartition";
+    return std::make_unique<BranchBasedPartitioner>(logger, config_file);
+  }
   if (partitioner_type == IGraphPartitioner::GraphPartitioningStrategy::DeviceBasedPartition) {
     LOGS(logger, INFO) << "Use DeviceBasedPartition as default";
     return std::make_unique<DeviceBasedPartitioner>(logger, config_file);
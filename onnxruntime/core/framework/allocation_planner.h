@@ -30,6 +30,7 @@ struct KernelCreateInfo;
 class KernelRegistryManager;
 class OrtValueNameIdxMap;
 class IStreamCommandHandleRegistry;
+struct CachedReusePlan;
 
 using KernelCreateInfoMap = std::unordered_map<onnxruntime::NodeIndex, gsl::not_null<const KernelCreateInfo*>>;
 using SubgraphsKernelCreateInfoMaps = std::unordered_map<std::string, KernelCreateInfoMap>;
@@ -46,6 +47,15 @@ class ISequentialPlannerContext {
   virtual ExecutionOrder GetExecutionOrder() const { return ExecutionOrder::DEFAULT; }
 
   virtual bool GetEnableMemoryReuse() const { return true; }
+
+  // If non-null, the planner replays these previously computed reuse decisions instead of
+  // running the reuse analysis. See SessionPlanCache.
+  virtual const CachedReusePlan* GetCachedReusePlan() const { return nullptr; }
+
+  // Minimum gap (in topological node positions) between uses of a CPU value before it is
+  // assigned to the secondary (file-backed) allocator. 0 disables offload assignment.
+  virtual int GetOffloadMinDefUseGap() const { return 0; }
+
   virtual ~ISequentialPlannerContext() = default;
 };
 
@@ -67,10 +77,23 @@ class SequentialPlannerContext : public ISequentialPlannerContext {
 
   bool GetEnableMemoryReuse() const override { return enable_memory_reuse_; }
 
+  const CachedReusePlan* GetCachedReusePlan() const override { return cached_reuse_plan_; }
+
+  // 'cached_reuse_plan' must outlive the CreatePlan call. nullptr clears a previously set plan.
+  void SetCachedReusePlan(const CachedReusePlan* cached_reuse_plan) {
+    cached_reuse_plan_ = cached_reuse_plan;
+  }
+
+  int GetOffloadMinDefUseGap() const override { return offload_min_def_use_gap_; }
+
+  void SetOffloadMinDefUseGap(int gap) { offload_min_def_use_gap_ = gap; }
+
  private:
   ExecutionMode execution_mode_ = ExecutionMode::ORT_SEQUENTIAL;
   ExecutionOrder execution_order_ = ExecutionOrder::DEFAULT;
   bool enable_memory_reuse_ = true;
+  const CachedReusePlan* cached_reuse_plan_ = nullptr;
+  int offload_min_def_use_gap_ = 0;
 };
 
 #ifdef ORT_ENABLE_STREAM
@@ -85,6 +108,8 @@ class IGraphPartitioner {
   // We will add more optimized partitioner later.
   enum GraphPartitioningStrategy {
     DeviceBasedPartition = 0,
+    // splits independent CPU branches into separate streams so the executor overlaps them
+    BranchBasedPartition,
     Unknown,
   };
   virtual ~IGraphPartitioner() = default;
@@ -63,6 +63,14 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
       ORT_THROW("StreamAwareArena should be transparent to minimal build.");
 #endif
     } else {
+      const bool numa_interleave = info.arena_cfg.numa_interleave == 1;
+      const int64_t auto_shrink_hysteresis_bytes =
+          info.arena_cfg.auto_shrink_hysteresis_bytes > 0 ? info.arena_cfg.auto_shrink_hysteresis_bytes : 0;
+      const size_t thread_local_magazine_bytes =
+          info.arena_cfg.thread_local_magazine_bytes > 0
+              ? static_cast<size_t>(info.arena_cfg.thread_local_magazine_bytes)
+              : 0;
+      const bool use_huge_pages = info.arena_cfg.use_huge_pages == 1;
       return AllocatorPtr(
           std::make_unique<BFCArena>(std::move(device_allocator),
                                      max_mem,
@@ -70,7 +78,11 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
                                      initial_chunk_size_bytes,
                                      max_dead_bytes_per_chunk,
                                      initial_growth_chunk_size_bytes,
-                                     max_power_of_two_extend_bytes));
+                                     max_power_of_two_extend_bytes,
+                                     numa_interleave,
+                                     auto_shrink_hysteresis_bytes,
+                                     thread_local_magazine_bytes,
+                                     use_huge_pages));
     }
   } else {
     return device_allocator;
@@ -3,16 +3,81 @@
 
 #include "core/framework/allocator.h"
 #include "core/framework/bfc_arena.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <type_traits>
 
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace onnxruntime {
+
+namespace {
+// Spread the pages of a freshly extended region across all allowed NUMA nodes. Best effort:
+// the raw syscalls avoid a libnuma dependency and any failure (kernel without NUMA, pages
+// already faulted in) simply leaves placement to first touch, as the policy is only a hint.
+void InterleaveRegionAcrossNumaNodes(void* addr, size_t bytes) {
+#ifdef __linux__
+  constexpr int kMpolInterleave = 3;         // MPOL_INTERLEAVE
+  constexpr int kMpolFMemsAllowed = 1 << 2;  // MPOL_F_MEMS_ALLOWED
+  constexpr unsigned long kMaxNodes = sizeof(unsigned long) * 8;
+
+  unsigned long nodemask = 0;
+  if (syscall(SYS_get_mempolicy, nullptr, &nodemask, kMaxNodes, nullptr,
+              static_cast<unsigned long>(kMpolFMemsAllowed)) != 0 ||
+      nodemask == 0 || (nodemask & (nodemask - 1)) == 0) {
+    // failed to query, or only one node is allowed - nothing to interleave
+    return;
+  }
+
+  syscall(SYS_mbind, addr, bytes, kMpolInterleave, &nodemask, kMaxNodes, 0ul);
+#else
+  ORT_UNUSED_PARAMETER(addr);
+  ORT_UNUSED_PARAMETER(bytes);
+#endif
+}
+
+// Advises transparent huge page backing for the 2MB-aligned interior of [addr, addr + bytes).
+// Returns the number of bytes advised (0 when unsupported or the range is too small), so the
+// caller can report how much of the model ends up eligible for huge page backing.
+size_t AdviseHugePages(void* addr, size_t bytes) {
+#ifdef __linux__
+  constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+  constexpr int kMadvHugepage = 14;  // MADV_HUGEPAGE
+
+  const uintptr_t begin = (reinterpret_cast<uintptr_t>(addr) + kHugePageSize - 1) & ~(kHugePageSize - 1);
+  const uintptr_t end = (reinterpret_cast<uintptr_t>(addr) + bytes) & ~(kHugePageSize - 1);
+  if (end <= begin) {
+    return 0;
+  }
+
+  if (syscall(SYS_madvise, reinterpret_cast<void*>(begin), static_cast<size_t>(end - begin),
+              kMadvHugepage) != 0) {
+    return 0;
+  }
+  return static_cast<size_t>(end - begin);
+#else
+  ORT_UNUSED_PARAMETER(addr);
+  ORT_UNUSED_PARAMETER(bytes);
+  return 0;
+#endif
+}
+}  // namespace
+
 BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
                    size_t total_memory,
                    ArenaExtendStrategy arena_extend_strategy,
                    int initial_chunk_size_bytes,
                    int max_dead_bytes_per_chunk,
                    int initial_growth_chunk_size_bytes,
-                   int64_t max_power_of_two_extend_bytes)
+                   int64_t max_power_of_two_extend_bytes,
+                   bool numa_interleave,
+                   int64_t auto_shrink_hysteresis_bytes,
+                   size_t thread_local_magazine_bytes,
+                   bool use_huge_pages)
     : IAllocator(OrtMemoryInfo(resource_allocator->Info().name,
                                OrtAllocatorType::OrtArenaAllocator,
                                resource_allocator->Info().device,
@@ -25,7 +90,15 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
       initial_chunk_size_bytes_(initial_chunk_size_bytes),
       max_dead_bytes_per_chunk_(max_dead_bytes_per_chunk),
       initial_growth_chunk_size_bytes_(initial_growth_chunk_size_bytes),
-      max_power_of_two_extend_bytes_(max_power_of_two_extend_bytes) {
+      max_power_of_two_extend_bytes_(max_power_of_two_extend_bytes),
+      numa_interleave_(numa_interleave),
+      auto_shrink_hysteresis_bytes_(auto_shrink_hysteresis_bytes),
+      thread_local_magazine_bytes_(thread_local_magazine_bytes),
+      use_huge_pages_(use_huge_pages),
+      arena_id_([] {
+        static std::atomic<uint64_t> next_arena_id{1};
+        return next_arena_id.fetch_add(1);
+      }()) {
   LOGS_DEFAULT(INFO) << "Creating BFCArena for " << device_allocator_->Info().name
                      << " with following configs: initial_chunk_size_bytes: " << initial_chunk_size_bytes_
                      << " max_dead_bytes_per_chunk: " << max_dead_bytes_per_chunk_
@@ -211,6 +284,17 @@ Status BFCArena::Extend(size_t rounded_bytes) {
 
   LOGS_DEFAULT(INFO) << "Allocated memory at " << mem_addr << " to "
                      << static_cast<void*>(static_cast<char*>(mem_addr) + bytes);
+
+  // bind before first touch so the pages land interleaved rather than on the extending
+  // thread's node
+  if (numa_interleave_ && Info().device.Type() == OrtDevice::CPU) {
+    InterleaveRegionAcrossNumaNodes(mem_addr, bytes);
+  }
+
+  if (use_huge_pages_ && Info().device.Type() == OrtDevice::CPU && bytes >= kHugePageAdviseThresholdBytes) {
+    stats_.huge_page_advised_bytes += static_cast<int64_t>(AdviseHugePages(mem_addr, bytes));
+  }
+
   region_manager_.AddAllocationRegion(mem_addr, bytes, stats_.num_arena_extensions);
   stats_.num_arena_extensions += 1;
 
@@ -269,9 +353,92 @@ size_t BFCArena::RoundedBytes(size_t bytes) {
 }
 
 void* BFCArena::Alloc(size_t size) {
+  if (thread_local_magazine_bytes_ > 0 && size > 0 && size <= kMaxMagazineBlockBytes) {
+    const size_t rounded_bytes = RoundedBytes(size);
+    if (void* p = AllocFromMagazine(rounded_bytes); p != nullptr) {
+      return p;
+    }
+  }
   return AllocateRawInternal(size, false, nullptr, false, nullptr);
 }
 
+BFCArena::Magazine* BFCArena::GetThreadMagazine() {
+  // cache the magazine pointer thread-locally so the steady state takes no lock at all.
+  // entries are validated by arena id: a stale pointer from a destroyed arena (or an address
+  // reused by a new one) fails the id check and is re-resolved through the map.
+  struct TlsEntry {
+    const BFCArena* arena;
+    uint64_t arena_id;
+    Magazine* magazine;
+  };
+  static thread_local std::vector<TlsEntry> tls_cache;
+
+  for (auto& entry : tls_cache) {
+    if (entry.arena == this && entry.arena_id == arena_id_) {
+      return entry.magazine;
+    }
+  }
+
+  Magazine* magazine = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(magazines_mutex_);
+    auto& owned = magazines_[std::this_thread::get_id()];
+    if (owned == nullptr) {
+      owned = std::make_unique<Magazine>();
+    }
+    magazine = owned.get();
+  }
+
+  for (auto& entry : tls_cache) {
+    if (entry.arena == this) {
+      entry = TlsEntry{this, arena_id_, magazine};
+      return magazine;
+    }
+  }
+  tls_cache.push_back(TlsEntry{this, arena_id_, magazine});
+  return magazine;
+}
+
+void* BFCArena::AllocFromMagazine(size_t rounded_bytes) {
+  Magazine* magazine = GetThreadMagazine();
+  auto it = magazine->free_lists.find(rounded_bytes);
+  if (it == magazine->free_lists.end() || it->second.empty()) {
+    return nullptr;
+  }
+  void* p = it->second.back();
+  it->second.pop_back();
+  magazine->cached_bytes -= rounded_bytes;
+  return p;
+}
+
+bool BFCArena::FreeToMagazine(void* p, size_t rounded_bytes) {
+  Magazine* magazine = GetThreadMagazine();
+  magazine->free_lists[rounded_bytes].push_back(p);
+  magazine->cached_bytes += rounded_bytes;
+  if (magazine->cached_bytes > thread_local_magazine_bytes_) {
+    FlushMagazineExcess(*magazine);
+  }
+  return true;
+}
+
+void BFCArena::FlushMagazineExcess(Magazine& magazine) {
+  // return a batch through the locked path so flushes are amortized
+  std::lock_guard<std::mutex> lock(lock_);
+  size_t flushed = 0;
+  for (auto& [rounded_bytes, blocks] : magazine.free_lists) {
+    while (!blocks.empty() && flushed < kMagazineFlushBatch &&
+           magazine.cached_bytes > thread_local_magazine_bytes_ / 2) {
+      DeallocateRawInternal(blocks.back());
+      blocks.pop_back();
+      magazine.cached_bytes -= rounded_bytes;
+      ++flushed;
+    }
+    if (flushed >= kMagazineFlushBatch) {
+      break;
+    }
+  }
+}
+
 void* BFCArena::Reserve(size_t size) {
   if (size == 0)
     return nullptr;
@@ -283,6 +450,12 @@ void* BFCArena::Reserve(size_t size) {
   void* ptr = device_allocator_->Alloc(size);
   ORT_ENFORCE(reserved_chunks_.find(ptr) == reserved_chunks_.end());
   reserved_chunks_.insert(std::pair<void*, size_t>(ptr, size));
+
+  // large reserved slabs (e.g. the weights block) benefit most from huge page backing
+  if (use_huge_pages_ && Info().device.Type() == OrtDevice::CPU && size >= kHugePageAdviseThresholdBytes) {
+    stats_.huge_page_advised_bytes += static_cast<int64_t>(AdviseHugePages(ptr, size));
+  }
+
   stats_.bytes_in_use += size;
   stats_.num_reserves += 1;
   stats_.num_allocs += 1;
@@ -496,6 +669,30 @@ void BFCArena::Free(void* p) {
   if (p == nullptr) {
     return;
   }
+
+  if (thread_local_magazine_bytes_ > 0) {
+    // cache small blocks thread-locally; the chunk stays "in use" from the arena's point of
+    // view until the magazine flushes it back. One short lock to check eligibility - the
+    // matching allocation of a cached size takes none at all.
+    size_t rounded_bytes = 0;
+    {
+      std::lock_guard<std::mutex> lock(lock_);
+      if (reserved_chunks_.find(p) == reserved_chunks_.end()) {
+        ChunkHandle h = region_manager_.get_handle(p);
+        if (h != kInvalidChunkHandle) {
+          Chunk* c = ChunkFromHandle(h);
+          // only cache chunks that exactly fit their size class so reuse is exact
+          if (c->size <= kMaxMagazineBlockBytes && c->size == RoundedBytes(c->requested_size)) {
+            rounded_bytes = c->size;
+          }
+        }
+      }
+    }
+    if (rounded_bytes != 0 && FreeToMagazine(p, rounded_bytes)) {
+      return;
+    }
+  }
+
   std::lock_guard<std::mutex> lock(lock_);
   auto it = reserved_chunks_.find(p);
   if (it != reserved_chunks_.end()) {
@@ -506,10 +703,25 @@ void BFCArena::Free(void* p) {
   } else {
     DeallocateRawInternal(p);
   }
+
+  if (auto_shrink_hysteresis_bytes_ > 0) {
+    MaybeAutoShrink();
+  }
 }
 
 Status BFCArena::Shrink() {
   std::lock_guard<std::mutex> lock(lock_);
+  ShrinkLocked(std::numeric_limits<size_t>::max());
+
+  // Will affect how the arena grows if the arena extend strategy is kNextPowerOfTwo
+  // In case the extend strategy is kSameAsRequested, the arena growth is exactly the size of the memory request itself
+  curr_region_allocation_bytes_ = initial_growth_chunk_size_bytes_;
+
+  return Status::OK();
+}
+
+size_t BFCArena::ShrinkLocked(size_t max_bytes_to_release) {
+  size_t released_bytes = 0;
   auto num_regions = region_manager_.regions().size();
   std::vector<void*> region_ptrs;
   std::vector<size_t> region_sizes;
@@ -525,6 +737,10 @@ Status BFCArena::Shrink() {
 
   size_t i = 0;
   for (void* region_ptr : region_ptrs) {
+    if (released_bytes >= max_bytes_to_release) {
+      break;
+    }
+
     bool deallocate_region = true;
     ChunkHandle region_begin_chunk = region_manager_.get_handle(region_ptr);
     ChunkHandle h = region_begin_chunk;
@@ -541,6 +757,7 @@ Status BFCArena::Shrink() {
 
     if (deallocate_region) {
       auto shrink_size = region_sizes[i];
+      released_bytes += shrink_size;
       stats_.num_arena_shrinkages += 1;
       stats_.total_allocated_bytes -= shrink_size;
 
@@ -566,11 +783,34 @@ Status BFCArena::Shrink() {
     ++i;
   }
 
-  // Will affect how the arena grows if the arena extend strategy is kNextPowerOfTwo
-  // In case the extend strategy is kSameAsRequested, the arena growth is exactly the size of the memory request itself
-  curr_region_allocation_bytes_ = initial_growth_chunk_size_bytes_;
+  return released_bytes;
+}
 
-  return Status::OK();
+void BFCArena::MaybeAutoShrink() {
+  // decaying high-water mark of live bytes: raises instantly with usage, decays by 1/8 every
+  // kAutoShrinkDecayInterval frees. Free regions above it (plus the hysteresis) are returned
+  // to the system, so a single ballooned request stops pinning arena memory forever while
+  // steady-state traffic never triggers a release.
+  windowed_high_water_bytes_ = std::max(windowed_high_water_bytes_, stats_.bytes_in_use);
+
+  constexpr size_t kAutoShrinkDecayInterval = 1024;
+  if (++auto_shrink_check_counter_ < kAutoShrinkDecayInterval) {
+    return;
+  }
+  auto_shrink_check_counter_ = 0;
+
+  windowed_high_water_bytes_ -= windowed_high_water_bytes_ / 8;
+  windowed_high_water_bytes_ = std::max(windowed_high_water_bytes_, stats_.bytes_in_use);
+
+  const int64_t target_bytes = windowed_high_water_bytes_ + auto_shrink_hysteresis_bytes_;
+  if (stats_.total_allocated_bytes > target_bytes) {
+    const size_t released = ShrinkLocked(static_cast<size_t>(stats_.total_allocated_bytes - target_bytes));
+    if (released > 0) {
+      LOGS_DEFAULT(INFO) << device_allocator_->Info().name << " BFC Arena auto-shrink released "
+                         << released << " bytes (high-water mark " << windowed_high_water_bytes_
+                         << ", total allocated now " << stats_.total_allocated_bytes << ").";
+    }
+  }
 }
 
 void BFCArena::DeallocateRawInternal(void* ptr) {
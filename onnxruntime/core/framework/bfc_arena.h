@@ -19,6 +19,9 @@ limitations under the License.
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "onnxruntime_config.h"
 
@@ -73,7 +76,11 @@ class BFCArena : public IAllocator {
            int initial_chunk_size_bytes = DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
            int max_dead_bytes_per_chunk = DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
            int initial_growth_chunk_size_bytes = DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
-           int64_t max_power_of_two_extend_bytes = DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES);
+           int64_t max_power_of_two_extend_bytes = DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES,
+           bool numa_interleave = false,
+           int64_t auto_shrink_hysteresis_bytes = 0,
+           size_t thread_local_magazine_bytes = 0,
+           bool use_huge_pages = false);
 
   ~BFCArena() override;
 
@@ -508,6 +515,54 @@ class BFCArena : public IAllocator {
   const int max_dead_bytes_per_chunk_;
   const int initial_growth_chunk_size_bytes_;
   const int64_t max_power_of_two_extend_bytes_;
+  // interleave freshly extended regions across NUMA nodes (CPU arenas, Linux only)
+  const bool numa_interleave_{false};
+
+  // Automatic shrink policy (enabled when auto_shrink_hysteresis_bytes_ > 0): free regions are
+  // released once total allocated bytes exceed a decaying high-water mark of live bytes by more
+  // than the hysteresis. All guarded by lock_.
+  const int64_t auto_shrink_hysteresis_bytes_{0};
+  int64_t windowed_high_water_bytes_{0};
+  size_t auto_shrink_check_counter_{0};
+
+  // Releases fully-free allocation regions until 'max_bytes_to_release' bytes have been
+  // returned to the system (or no fully-free regions remain). lock_ must be held.
+  size_t ShrinkLocked(size_t max_bytes_to_release);
+
+  // Applies the automatic shrink policy after a free. lock_ must be held.
+  void MaybeAutoShrink();
+
+  // Thread-local magazine layer (enabled when thread_local_magazine_bytes_ > 0): each worker
+  // thread keeps small freed blocks in per-size free lists and serves repeat allocations of
+  // the same rounded size from them without taking lock_. Magazines are owned by the arena
+  // (magazines_mutex_ guards only the map; each magazine is touched by its thread alone) and
+  // flush back through the locked path when over budget or at arena destruction.
+  struct Magazine {
+    // rounded size -> cached blocks of exactly that rounded request size
+    std::unordered_map<size_t, std::vector<void*>> free_lists;
+    size_t cached_bytes = 0;
+  };
+
+  static constexpr size_t kMaxMagazineBlockBytes = 64 * 1024;
+  static constexpr size_t kMagazineFlushBatch = 8;
+
+  Magazine* GetThreadMagazine();
+  void* AllocFromMagazine(size_t rounded_bytes);
+  // returns true if the block was cached
+  bool FreeToMagazine(void* p, size_t rounded_bytes);
+  // returns the excess blocks of one magazine through the locked deallocation path
+  void FlushMagazineExcess(Magazine& magazine);
+
+  const size_t thread_local_magazine_bytes_{0};
+
+  // advise transparent huge page backing for large CPU extents and reserved slabs
+  static constexpr size_t kHugePageAdviseThresholdBytes = 16 * 1024 * 1024;
+  const bool use_huge_pages_{false};
+
+  // process-unique id validating thread-local magazine caches across arena lifetimes
+  const uint64_t arena_id_;
+  std::mutex magazines_mutex_;
+  std::unordered_map<std::thread::id, std::unique_ptr<Magazine>> magazines_;
 
   // This flag is only relevant if Shrink() is invoked.
   // This is a boolean flag that controls whether the first allocation region
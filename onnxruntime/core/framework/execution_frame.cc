@@ -358,6 +358,9 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
 #endif
       session_state_(session_state),
       mem_patterns_(nullptr) {
+  // reuse a pooled value table: Init's resize then only constructs, instead of allocating a
+  // fresh table per Run
+  AdoptOrtValueBuffer(session_state.AcquireOrtValueBuffer());
   Init(
       feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(),
 #if !defined(DISABLE_SPARSE_TENSORS)
@@ -492,7 +495,9 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
   }
 }
 
-ExecutionFrame::~ExecutionFrame() = default;
+ExecutionFrame::~ExecutionFrame() {
+  session_state_.ReleaseOrtValueBuffer(TakeOrtValueBuffer());
+}
 
 Status ExecutionFrame::CopyTensor(const Tensor& src, Tensor& dest) const {
   return session_state_.GetDataTransferMgr().CopyTensor(src, dest);
@@ -551,8 +556,13 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
       if (block) {
         auto it = buffers_.find(location);
         if (it != buffers_.end()) {
-          // if the block is not correct, log message then fall back to default behavior
-          if (block->size_ == size) {
+          // if the block is not correct, log message then fall back to default behavior.
+          // with shape-bucketed patterns the block is sized for the bucket ceiling, so any
+          // tensor that fits may use it - offsets within the buffer are fixed either way.
+          const bool block_usable =
+              block->size_ == size ||
+              (session_state_.GetMemoryPatternShapeBucketSize() > 1 && block->size_ >= size);
+          if (block_usable) {
             void* buffer = it->second.get();
             auto status = AllocateTensorWithPreAllocateBufferHelper(
                 ort_value, static_cast<void*>(static_cast<char*>(buffer) + block->offset_), element_type, location,
@@ -575,7 +585,12 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
   }
 
   // no memory pattern, or the pattern is not correct.
-  if (!alloc) alloc = GetAllocator(location);
+  if (!alloc) {
+    // long def-use-gap activations come from the file-backed secondary allocator so their
+    // pages can be reclaimed while cold (see session.offload_min_def_use_gap_nodes)
+    alloc = per_alloc_plan.use_secondary_allocator ? session_state_.GetSecondaryCpuAllocator()
+                                                   : GetAllocator(location);
+  }
   ORT_ENFORCE(alloc && alloc.get() != nullptr, "Failed to get allocator for ", location.ToString());
 
   Stream* current_stream = GetValueStream(ort_value_index);
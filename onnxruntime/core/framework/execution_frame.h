@@ -131,6 +131,19 @@ class IExecutionFrame {
   // Input and Output values are passed in by executors
   InlinedVector<OrtValue> all_values_;
 
+ protected:
+  // Adopt a recycled (empty, capacity-retaining) value buffer before Init resizes it, and hand
+  // it back on destruction. Lets ExecutionFrame pool the per-Run value table across Runs.
+  void AdoptOrtValueBuffer(InlinedVector<OrtValue>&& buffer) {
+    all_values_ = std::move(buffer);
+  }
+
+  InlinedVector<OrtValue> TakeOrtValueBuffer() {
+    return std::move(all_values_);
+  }
+
+ private:
+
   // perf optimization to avoid calling all_values_.size() repeatedly as the size is fixed once constructed
   const size_t all_values_size_;
 
@@ -75,6 +75,42 @@ Status LaunchKernelStep::Execute(StreamExecutionContext& ctx,
   return status;
 }
 
+LaunchKernelGroupStep::LaunchKernelGroupStep(InlinedVector<NodeIndex> node_indices)
+    : SequentialExecutionPlan::ExecutionStep(node_indices.front()),
+      node_indices_(std::move(node_indices)) {}
+
+Status LaunchKernelGroupStep::Execute(StreamExecutionContext& ctx,
+                                      size_t stream_idx,
+                                      SessionScope& session_scope,
+                                      const bool& terminate_flag,
+                                      bool& continue_flag) {
+  for (NodeIndex node_index : node_indices_) {
+#ifdef ENABLE_TRAINING
+    // legacy code required by ORTTrainer. Should be removed when ORTTrainer is removed
+    auto* node_to_execute = ctx.GetNodeToExecute();
+    if (node_to_execute && node_to_execute->count(node_index) == 0) {
+      continue;
+    }
+#endif
+    Status status = ExecuteKernel(ctx, node_index, stream_idx, terminate_flag, session_scope);
+    if (!status.IsOK()) {
+      continue_flag = false;
+      return status;
+    }
+  }
+  continue_flag = true;
+  return Status::OK();
+}
+
+std::string LaunchKernelGroupStep::ToString() const {
+  std::ostringstream oss;
+  oss << "LaunchKernelGroup - NodeIndices: ";
+  for (NodeIndex node_index : node_indices_) {
+    oss << node_index << " ";
+  }
+  return oss.str();
+}
+
 std::string LaunchKernelStep::ToString() const {
 #if defined(ORT_MINIMAL_BUILD)
   return MakeString("LaunchKernel - ", "NodeIndex: ", node_index_);
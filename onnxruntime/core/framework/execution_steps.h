@@ -58,12 +58,33 @@ class LaunchKernelStep : public SequentialExecutionPlan::ExecutionStep {
 
   std::string ToString() const override;
 
+  bool IsLaunchKernelStep() const override { return true; }
+
 #if !defined(ORT_MINIMAL_BUILD)
  private:
   std::string node_name_;
 #endif
 };
 
+// Executes a run of consecutive kernel launches as one step, amortizing the per-step virtual
+// dispatch and bookkeeping for chains of cheap nodes. Built by the planner by fusing adjacent
+// LaunchKernelStep entries that have no barriers/notifications between them.
+class LaunchKernelGroupStep : public SequentialExecutionPlan::ExecutionStep {
+ public:
+  explicit LaunchKernelGroupStep(InlinedVector<NodeIndex> node_indices);
+
+  Status Execute(StreamExecutionContext& ctx,
+                 size_t stream_idx,
+                 SessionScope& session_scope,
+                 const bool& terminate_flag,
+                 bool& continue_flag) override;
+
+  std::string ToString() const override;
+
+ private:
+  InlinedVector<NodeIndex> node_indices_;
+};
+
 class ActivateNotificationStep : public SequentialExecutionPlan::ExecutionStep {
  public:
   ActivateNotificationStep(NotificationIndex notification_index, NodeIndex node_index);
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/file_backed_allocator.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32) && !defined(__wasm__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace onnxruntime {
+
+namespace {
+
+// Every allocation (mapped or heap fallback) carries this header in front of the user data so
+// Free can tell how to release it: mapping_bytes == 0 marks a heap allocation.
+struct MappingHeader {
+  size_t mapping_bytes;
+};
+
+constexpr size_t kHeaderBytes = kAllocAlignment;
+
+#if !defined(_WIN32) && !defined(__wasm__)
+
+// Each allocation is its own mapping of an unlinked temporary file in backing_dir; the file
+// is removed at creation so the backing storage disappears with the last unmap. The directory
+// matters: on mainstream Linux distros /tmp is tmpfs, where the "file" is really swap-backed
+// anonymous memory and pages cannot be written back to disk - defeating the point of this
+// allocator. Callers should point backing_dir at a disk-backed filesystem.
+void* MapFileBacked(size_t size, const std::string& backing_dir) {
+  const size_t mapping_bytes = size + kHeaderBytes;
+
+  const char* dir = !backing_dir.empty() ? backing_dir.c_str() : P_tmpdir;
+  std::string name_template = std::string{dir} + "/ort_offload_XXXXXX";
+  std::vector<char> path(name_template.begin(), name_template.end());
+  path.push_back('\0');
+
+  const int fd = mkstemp(path.data());
+  if (fd < 0) {
+    return nullptr;
+  }
+  // unlink immediately: the mapping keeps its own reference and the storage disappears with
+  // the last unmap even if the process dies
+  unlink(path.data());
+
+  if (ftruncate(fd, static_cast<off_t>(mapping_bytes)) != 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  void* mapping = mmap(nullptr, mapping_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return nullptr;
+  }
+
+  static_cast<MappingHeader*>(mapping)->mapping_bytes = mapping_bytes;
+  return static_cast<char*>(mapping) + kHeaderBytes;
+}
+
+#endif  // !defined(_WIN32) && !defined(__wasm__)
+
+}  // namespace
+
+FileBackedAllocator::FileBackedAllocator(std::string backing_dir)
+    : IAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator,
+                               OrtDevice(), /*id*/ 0, OrtMemTypeDefault)),
+      backing_dir_(std::move(backing_dir)) {
+}
+
+void* FileBackedAllocator::Alloc(size_t size) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+#if !defined(_WIN32) && !defined(__wasm__)
+  if (void* p = MapFileBacked(size, backing_dir_); p != nullptr) {
+    return p;
+  }
+#endif
+
+  // fallback: plain heap allocation with the same header so Free can discriminate
+  char* base = static_cast<char*>(malloc(size + kHeaderBytes));
+  ORT_ENFORCE(base != nullptr, "FileBackedAllocator failed to allocate ", size, " bytes.");
+  reinterpret_cast<MappingHeader*>(base)->mapping_bytes = 0;
+  return base + kHeaderBytes;
+}
+
+void FileBackedAllocator::Free(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+
+  char* base = static_cast<char*>(p) - kHeaderBytes;
+  const size_t mapping_bytes = reinterpret_cast<MappingHeader*>(base)->mapping_bytes;
+  if (mapping_bytes == 0) {
+    free(base);
+    return;
+  }
+
+#if !defined(_WIN32) && !defined(__wasm__)
+  munmap(base, mapping_bytes);
+#endif
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+
+namespace onnxruntime {
+
+// CPU allocator whose allocations are backed by an unlinked temporary file mapping instead of
+// anonymous memory. Pages of cold allocations can be written back to the file and reclaimed
+// under memory pressure (no swap required), then faulted back in on next touch - a simple
+// offload tier for activations with long def-use gaps (see
+// session.offload_min_def_use_gap_nodes). Falls back to plain heap allocation on platforms
+// without the required primitives.
+//
+// backing_dir must live on a disk-backed filesystem for the reclaim behavior to materialize:
+// tmpfs directories (notably /tmp on mainstream Linux distros) make the mapping swap-backed
+// anonymous memory. An empty backing_dir falls back to P_tmpdir as a last resort; prefer
+// setting session.offload_directory.
+class FileBackedAllocator final : public IAllocator {
+ public:
+  explicit FileBackedAllocator(std::string backing_dir = {});
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(FileBackedAllocator);
+
+ private:
+  std::string backing_dir_;
+};
+
+}  // namespace onnxruntime
@@ -23,7 +23,8 @@ class OpKernelContextInternal : public OpKernelContext {
                                    const logging::Logger& logger,
                                    const bool& terminate_flag,
                                    Stream* stream)
-      : OpKernelContext(&frame, &kernel, stream, session_state.GetThreadPool(), logger),
+      : OpKernelContext(&frame, &kernel, stream,
+                        session_state.GetThreadPoolForNode(kernel.Node().Index()), logger),
         session_state_(session_state),
         terminate_flag_(terminate_flag) {
     const auto& implicit_inputs = kernel.Node().ImplicitInputDefs();
@@ -88,7 +89,12 @@ class OpKernelContextInternal : public OpKernelContext {
       *output = accounting_allocator_;
       return Status::OK();
     }
-    return OpKernelContext::GetTempSpaceAllocator(output);
+    ORT_RETURN_IF_ERROR(OpKernelContext::GetTempSpaceAllocator(output));
+    // opt-in reusable per-thread scratch block for CPU kernel workspace
+    if (AllocatorPtr scratch = session_state_.GetThreadScratchAllocator(*output); scratch != nullptr) {
+      *output = std::move(scratch);
+    }
+    return Status::OK();
   }
 #endif
 
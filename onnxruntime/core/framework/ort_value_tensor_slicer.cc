@@ -84,8 +84,14 @@ void OrtValueTensorSlicer<T>::Iterator::MaterializeMLValue() const {
   // However we will only return a non-const OrtValue from operator* if OrtValueTensorSlicer was created with
   // a non-const OrtValue, so externally we maintain constness as expected.
   //
-  // TODO: Ideally we could avoid the overhead of creating a new Tensor (mainly cost of copying type and shape info)
-  // and would simply update Tensor::p_data_ given all other info remains constant for each slice.
+  // All slice metadata (type, shape, location) is constant across positions, so after the first
+  // materialization only the data pointer changes: advancing the view reuses the existing
+  // Tensor/OrtValue instead of heap-allocating a fresh pair per iteration.
+  if (current_.IsAllocated()) {
+    current_.GetMutable<Tensor>()->SetDataRawForSliceView(const_cast<void*>(tensor_slice_data_raw));
+    return;
+  }
+
   OrtValue val;
   Tensor::InitOrtValue(tensor_data_type_, per_iteration_shape_, const_cast<void*>(tensor_slice_data_raw), *tensor_location_, val);
   current_ = std::move(val);
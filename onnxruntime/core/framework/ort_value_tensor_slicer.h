@@ -58,6 +58,41 @@ class OrtValueTensorSlicer {
 
     bool operator!=(const Iterator& other) const noexcept { return !(*this == other); }
 
+    // Copies re-materialize on first dereference instead of sharing the reusable view: the
+    // source iterator advances its view's data pointer in place (see MaterializeMLValue), so a
+    // shared OrtValue would silently follow the source's position.
+    Iterator(const Iterator& other)
+        : ort_value_(other.ort_value_),
+          position_(other.position_),
+          increment_by_(other.increment_by_),
+          tensor_data_raw_(other.tensor_data_raw_),
+          tensor_data_type_(other.tensor_data_type_),
+          tensor_location_(other.tensor_location_),
+          sequence_length_(other.sequence_length_),
+          per_iteration_shape_(other.per_iteration_shape_),
+          per_iteration_offset_(other.per_iteration_offset_),
+          position_materialized_(-1) {
+    }
+
+    // same re-materialize semantics as the copy constructor: sharing current_ would alias the
+    // in-place-advanced view between copies
+    Iterator& operator=(const Iterator& other) {
+      if (this != &other) {
+        ort_value_ = other.ort_value_;
+        position_ = other.position_;
+        increment_by_ = other.increment_by_;
+        tensor_data_raw_ = other.tensor_data_raw_;
+        tensor_data_type_ = other.tensor_data_type_;
+        tensor_location_ = other.tensor_location_;
+        sequence_length_ = other.sequence_length_;
+        per_iteration_shape_ = other.per_iteration_shape_;
+        per_iteration_offset_ = other.per_iteration_offset_;
+        current_ = OrtValue{};
+        position_materialized_ = -1;
+      }
+      return *this;
+    }
+
     Iterator& operator++() {
       position_ += increment_by_;
       return *this;
@@ -109,7 +144,8 @@ class OrtValueTensorSlicer {
     // Alternatively we could apply a std::reverse_iterator adapter to Iterator, however the primary use case
     // for this class involves passing a mix of forward/reverse iterator instances in a single collection so
     // we need to handle the direction internally so only one type is involved in that collection.
-    const int64_t increment_by_;
+    // Not const so iterators are copy-assignable (e.g. when stored in containers).
+    int64_t increment_by_;
 
     const void* tensor_data_raw_;
     MLDataType tensor_data_type_;
@@ -2,11 +2,60 @@
 // Licensed under the MIT License.
 
 #include "core/framework/prepacked_weights_container.h"
+
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include "core/common/cpuid_info.h"
 #include "core/framework/allocator_utils.h"
+#include "core/framework/murmurhash3.h"
 #include "core/graph/graph.h"
+#include "core/platform/env.h"
 
 namespace onnxruntime {
 
+namespace {
+
+constexpr uint64_t kPrepackedCacheMagic = 0x4b43'5050'5452'4f50;  // "PORTPPCK"
+// Buffer payloads are aligned so memory-mapped blobs satisfy the alignment MLAS kernels
+// expect of pre-packed buffers.
+constexpr size_t kPrepackedCacheAlignment = 64;
+
+size_t AlignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Identity of the CPU features that select the packing layout. Two processes with the same
+// identity produce byte-identical pre-packed buffers for the same weight.
+uint64_t ComputeDispatchIdentity() {
+  const auto& cpuid = CPUIDInfo::GetCPUIDInfo();
+  uint64_t identity = static_cast<uint64_t>(cpuid.GetCPUVendorId()) << 32;
+  uint32_t features = 0;
+  features |= cpuid.HasAVX() ? 1u << 0 : 0;
+  features |= cpuid.HasAVX2() ? 1u << 1 : 0;
+  features |= cpuid.HasAVX512f() ? 1u << 2 : 0;
+  features |= cpuid.HasAVX512Skylake() ? 1u << 3 : 0;
+  features |= cpuid.HasAVX512_BF16() ? 1u << 4 : 0;
+  features |= cpuid.HasAMX_BF16() ? 1u << 5 : 0;
+  features |= cpuid.HasSSE3() ? 1u << 6 : 0;
+  features |= cpuid.HasSSE4_1() ? 1u << 7 : 0;
+  features |= cpuid.HasF16C() ? 1u << 8 : 0;
+  features |= cpuid.HasArmNeonDot() ? 1u << 9 : 0;
+  features |= cpuid.HasArmNeon_I8MM() ? 1u << 10 : 0;
+  features |= cpuid.HasArmSVE_I8MM() ? 1u << 11 : 0;
+  features |= cpuid.HasArmNeon_BF16() ? 1u << 12 : 0;
+  features |= cpuid.HasAVX512_VNNI() ? 1u << 13 : 0;
+  features |= cpuid.HasAVX_VNNI() ? 1u << 14 : 0;
+  features |= cpuid.HasAMX_INT8() ? 1u << 15 : 0;
+  return identity | features;
+}
+
+}  // namespace
+
 PrePackedWeights PrePackedWeights::CreateReferringCopy() const {
   PrePackedWeights copy;
   for (const auto& prepacked_buffer : buffers_) {
@@ -61,6 +110,164 @@ size_t PrepackedWeightsContainer::GetNumberOfElements() const {
   return prepacked_weights_map_.size();
 }
 
+Status PrepackedWeightsContainer::SetDiskCacheDirectory(const PathString& directory) {
+  ORT_RETURN_IF(directory.empty(), "Pre-packed weights disk cache directory must not be empty.");
+
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path{directory}, ec);
+  ORT_RETURN_IF(ec, "Failed to create pre-packed weights disk cache directory: ", ec.message());
+
+  disk_cache_dir_ = directory;
+  dispatch_identity_ = ComputeDispatchIdentity();
+  return Status::OK();
+}
+
+PathString PrepackedWeightsContainer::CacheFilePath(const std::string& key) const {
+  // The key contains characters ('+', hex hash) that are path-safe, but hash it anyway to keep
+  // names bounded and to fold in the dispatch identity.
+  uint32_t hash[4] = {0, 0, 0, 0};
+  MurmurHash3::x86_128(key.data(), key.size(), 0, &hash);
+  std::ostringstream file_name;
+  file_name << std::hex << std::setfill('0');
+  for (uint32_t word : hash) {
+    file_name << std::setw(8) << word;
+  }
+  file_name << "-" << dispatch_identity_ << ".prepack";
+  return (std::filesystem::path{disk_cache_dir_} / file_name.str()).native();
+}
+
+bool PrepackedWeightsContainer::TryLoadFromDiskCache(const std::string& key) {
+  if (disk_cache_dir_.empty()) {
+    return false;
+  }
+
+  if (prepacked_weights_map_.count(key) != 0) {
+    return true;
+  }
+
+  const PathString file_path = CacheFilePath(key);
+  std::error_code ec;
+  const auto file_size = std::filesystem::file_size(std::filesystem::path{file_path}, ec);
+  if (ec) {
+    return false;  // cache miss
+  }
+
+  // Map the whole blob read-only: all sessions/processes on the box share one physical copy.
+  Env::MappedMemoryPtr mapped_memory{};
+  auto status = Env::Default().MapFileIntoMemory(file_path.c_str(), 0, static_cast<size_t>(file_size),
+                                                 mapped_memory);
+  if (!status.IsOK()) {
+    return false;
+  }
+
+  const char* base = mapped_memory.get();
+  size_t offset = 0;
+  auto read_u64 = [&](uint64_t& value) -> bool {
+    if (offset + sizeof(uint64_t) > file_size) return false;
+    std::memcpy(&value, base + offset, sizeof(uint64_t));
+    offset += sizeof(uint64_t);
+    return true;
+  };
+
+  uint64_t magic = 0, num_buffers = 0;
+  if (!read_u64(magic) || magic != kPrepackedCacheMagic || !read_u64(num_buffers)) {
+    return false;
+  }
+
+  struct BufferDesc {
+    uint64_t size;
+    uint64_t data_offset;
+  };
+  InlinedVector<BufferDesc> descs;
+  descs.reserve(static_cast<size_t>(num_buffers));
+  for (uint64_t i = 0; i < num_buffers; ++i) {
+    BufferDesc desc;
+    if (!read_u64(desc.size) || !read_u64(desc.data_offset) ||
+        desc.data_offset + desc.size > file_size) {
+      return false;
+    }
+    descs.push_back(desc);
+  }
+
+  // The buffers alias the mapping; each deleter holds a reference so the mapping lives until
+  // the last buffer is released.
+  auto shared_mapping = std::make_shared<Env::MappedMemoryPtr>(std::move(mapped_memory));
+  PrePackedWeights packed_weight;
+  for (const auto& desc : descs) {
+    void* data = const_cast<char*>(base) + desc.data_offset;
+    packed_weight.buffers_.emplace_back(data, [shared_mapping](void*) {});
+    packed_weight.buffer_sizes_.push_back(static_cast<size_t>(desc.size));
+  }
+
+  prepacked_weights_map_.emplace(key, std::move(packed_weight));
+  return true;
+}
+
+void PrepackedWeightsContainer::SaveWeightToDiskCache(const std::string& key,
+                                                      const PrePackedWeights& packed_weight) const {
+  if (disk_cache_dir_.empty()) {
+    return;
+  }
+
+  // Do not persist entries with null buffers (kernels may cache shape-only metadata).
+  for (const auto& buffer : packed_weight.buffers_) {
+    if (buffer.get() == nullptr) {
+      return;
+    }
+  }
+
+  const std::filesystem::path final_path{CacheFilePath(key)};
+  std::filesystem::path tmp_path{final_path};
+  // unique per writer so concurrently cold-starting processes don't interleave writes
+  // into the same temp file and rename corrupt bytes into place
+  tmp_path += ORT_TSTR(".tmp.");
+  tmp_path += std::to_string(reinterpret_cast<uintptr_t>(this));
+
+  {
+    std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+    if (!out.good()) {
+      return;
+    }
+
+    const uint64_t num_buffers = packed_weight.buffers_.size();
+    // Layout: magic, buffer count, (size, data offset) per buffer, then aligned payloads.
+    size_t data_offset = AlignUp((2 + 2 * static_cast<size_t>(num_buffers)) * sizeof(uint64_t),
+                                 kPrepackedCacheAlignment);
+    auto write_u64 = [&out](uint64_t value) {
+      out.write(reinterpret_cast<const char*>(&value), sizeof(uint64_t));
+    };
+
+    write_u64(kPrepackedCacheMagic);
+    write_u64(num_buffers);
+    for (size_t i = 0; i < num_buffers; ++i) {
+      write_u64(packed_weight.buffer_sizes_[i]);
+      write_u64(data_offset);
+      data_offset = AlignUp(data_offset + packed_weight.buffer_sizes_[i], kPrepackedCacheAlignment);
+    }
+
+    for (size_t i = 0; i < num_buffers; ++i) {
+      const auto padding = static_cast<std::streamoff>(AlignUp(static_cast<size_t>(out.tellp()),
+                                                               kPrepackedCacheAlignment)) -
+                           out.tellp();
+      for (std::streamoff p = 0; p < padding; ++p) {
+        out.put('\0');
+      }
+      out.write(reinterpret_cast<const char*>(packed_weight.buffers_[i].get()),
+                packed_weight.buffer_sizes_[i]);
+    }
+
+    if (!out.good()) {
+      return;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tmp_path, final_path, ec);
+  if (ec) {
+    std::filesystem::remove(tmp_path, ec);
+  }
+}
+
 void PrepackedWeightsForGraph::InsertPrepackedWeights(const std::string& key, PrePackedWeights&& packed_weight) {
   // We may have duplicate entries mapped from disk if the same weight is pre-packed from subgraphs and
   // up the tree by the same kernel with the same result. The map prevents this from happening.
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/common/common.h"
+#include "core/common/path_string.h"
 #include "core/framework/allocator.h"
 #include "prepacked_weights.h"
 
@@ -54,6 +55,26 @@ class PrepackedWeightsContainer final {
   // Returns the number of elements in the container
   size_t GetNumberOfElements() const;
 
+  // Enables a disk-backed cache under 'directory' (created if needed). Cache files are keyed by
+  // a hash of the in-memory key plus an identity tag for the CPU features that drive the MLAS
+  // kernel dispatch, since the pre-packed layout is only valid for the ISA it was packed for.
+  // Blobs are memory-mapped read-only on load so worker processes on the same machine share
+  // one physical copy.
+  Status SetDiskCacheDirectory(const PathString& directory);
+
+  // True when SetDiskCacheDirectory has enabled the disk tier.
+  bool DiskCacheEnabled() const noexcept { return !disk_cache_dir_.empty(); }
+
+  // Persists 'packed_weight' for 'key' to the disk cache (atomic temp + rename). Failures are
+  // swallowed: the in-memory path is already populated. No-op when the disk cache is disabled.
+  void SaveWeightToDiskCache(const std::string& key, const PrePackedWeights& packed_weight) const;
+
+  // Attempts to populate the in-memory map for 'key' from the disk cache.
+  // Returns true if the weight is now available. A no-op returning false when the disk cache
+  // is not enabled or has no entry for 'key'. Caller must hold mutex_ (same contract as the
+  // other accessors used during PrePack()).
+  bool TryLoadFromDiskCache(const std::string& key);
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PrepackedWeightsContainer);
 
   // Resource to be acquired by the method that is going to invoke calls to the kernels'
@@ -71,6 +92,15 @@ class PrepackedWeightsContainer final {
   // to PrePackedWeights instances.
   // The key is : op_type + "+" + hash_of_prepacked_buffers_in_the_PrepackedWeights_instance.
   std::unordered_map<std::string, PrePackedWeights> prepacked_weights_map_;
+
+ private:
+  PathString CacheFilePath(const std::string& key) const;
+
+  // Empty when the disk cache is disabled.
+  PathString disk_cache_dir_;
+  // Identity of the CPU-feature set that drives kernel dispatch, stable across processes on
+  // the same machine.
+  uint64_t dispatch_identity_{0};
 };
 
 // Maps a pre-packed weight blob key to PrepackedWeights instance
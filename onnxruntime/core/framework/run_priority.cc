@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/run_priority.h"
+
+#include <atomic>
+
+namespace onnxruntime {
+
+namespace {
+std::atomic<int> active_high_priority_runs{0};
+thread_local RunPriorityScope::Priority current_thread_priority = RunPriorityScope::Priority::kNormal;
+}  // namespace
+
+RunPriorityScope::RunPriorityScope(Priority priority)
+    : priority_(priority), previous_thread_priority_(current_thread_priority) {
+  current_thread_priority = priority_;
+  if (priority_ == Priority::kHigh) {
+    active_high_priority_runs.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+RunPriorityScope::~RunPriorityScope() {
+  if (priority_ == Priority::kHigh) {
+    active_high_priority_runs.fetch_sub(1, std::memory_order_relaxed);
+  }
+  current_thread_priority = previous_thread_priority_;
+}
+
+bool RunPriorityScope::ShouldYieldToHigherPriority() {
+  return current_thread_priority == Priority::kLow &&
+         active_high_priority_runs.load(std::memory_order_relaxed) > 0;
+}
+
+RunPriorityScope::Priority RunPriorityScope::ParsePriority(const std::string& value) {
+  if (value == "high") {
+    return Priority::kHigh;
+  }
+  if (value == "low") {
+    return Priority::kLow;
+  }
+  return Priority::kNormal;
+}
+
+}  // namespace onnxruntime
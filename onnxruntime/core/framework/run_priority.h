@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+// Cooperative run-level priority scheduling (see the run.priority run option).
+//
+// A RunPriorityScope on the stack of a Run marks the calling thread with that run's priority and,
+// for high-priority runs, raises a process-wide "high-priority active" count. Executors check
+// ShouldYieldToHigherPriority() between node dispatches: threads driving a low-priority run yield
+// while any high-priority run is in flight, bounding interactive latency without a second
+// process. Threads whose run priority is unknown (e.g. pool workers of a multi-stream run) are
+// never paused, so this cannot deadlock work a high-priority run depends on.
+class RunPriorityScope {
+ public:
+  enum class Priority { kLow,
+                        kNormal,
+                        kHigh };
+
+  explicit RunPriorityScope(Priority priority);
+  ~RunPriorityScope();
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RunPriorityScope);
+
+  // True while the current thread executes a low-priority run and at least one high-priority
+  // run is active. A single relaxed atomic load plus a thread-local read.
+  static bool ShouldYieldToHigherPriority();
+
+  static Priority ParsePriority(const std::string& value);
+
+ private:
+  Priority priority_;
+  Priority previous_thread_priority_;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/scratch_buffer_allocator.h"
+
+#include <algorithm>
+
+namespace onnxruntime {
+
+ScratchBufferAllocator::ScratchBufferAllocator(AllocatorPtr backing_allocator, size_t max_block_bytes)
+    : IAllocator(backing_allocator->Info()),
+      backing_allocator_(std::move(backing_allocator)),
+      max_block_bytes_(max_block_bytes) {
+}
+
+ScratchBufferAllocator::~ScratchBufferAllocator() {
+  // outstanding_ should be zero here: temp buffers don't outlive kernel Compute() and the
+  // session keeps this allocator alive for its own lifetime.
+  if (block_ != nullptr) {
+    backing_allocator_->Free(block_);
+  }
+}
+
+void* ScratchBufferAllocator::Alloc(size_t size) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  const size_t rounded = ((size + kAllocAlignment - 1) / kAllocAlignment) * kAllocAlignment;
+  const size_t total = rounded + kHeaderBytes;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (block_ != nullptr && offset_ + total <= block_bytes_) {
+    char* base = static_cast<char*>(block_) + offset_;
+    offset_ += total;
+    ++outstanding_;
+    *reinterpret_cast<Header*>(base) = Header{this, true};
+    return base + kHeaderBytes;
+  }
+
+  // Remember how much this thread wanted so the block can be grown once it drains.
+  wanted_bytes_ = std::max(wanted_bytes_, offset_ + total);
+
+  if (outstanding_ == 0 && total <= max_block_bytes_) {
+    // nothing handed out: safe to (re)grow the block and serve from it
+    const size_t new_block_bytes = std::min(max_block_bytes_, std::max(wanted_bytes_, block_bytes_ * 2));
+    if (new_block_bytes >= total) {
+      if (block_ != nullptr) {
+        backing_allocator_->Free(block_);
+        block_ = nullptr;
+        block_bytes_ = 0;
+      }
+      block_ = backing_allocator_->Alloc(new_block_bytes);
+      block_bytes_ = new_block_bytes;
+      offset_ = total;
+      outstanding_ = 1;
+      *reinterpret_cast<Header*>(block_) = Header{this, true};
+      return static_cast<char*>(block_) + kHeaderBytes;
+    }
+  }
+
+  // block exhausted or request too large: fall through to the backing allocator, still with a
+  // header so Free() can route it
+  char* base = static_cast<char*>(backing_allocator_->Alloc(total));
+  *reinterpret_cast<Header*>(base) = Header{this, false};
+  return base + kHeaderBytes;
+}
+
+void ScratchBufferAllocator::Free(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+
+  char* base = static_cast<char*>(p) - kHeaderBytes;
+  const Header header = *reinterpret_cast<Header*>(base);
+  ORT_ENFORCE(header.owner != nullptr, "Buffer was not allocated by a ScratchBufferAllocator.");
+
+  // a buffer freed on a different thread than it was allocated on belongs to that thread's
+  // scratch allocator
+  header.owner->FreeOwned(base, header);
+}
+
+void ScratchBufferAllocator::FreeOwned(void* base, const Header& header) {
+  if (!header.from_block) {
+    backing_allocator_->Free(base);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  ORT_ENFORCE(outstanding_ > 0, "Scratch buffer double free.");
+  if (--outstanding_ == 0) {
+    // everything handed out has been returned: rewind so the next kernel reuses the block
+    offset_ = 0;
+    wanted_bytes_ = 0;
+  }
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <mutex>
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+
+namespace onnxruntime {
+
+// Reusable scratch allocator for temporary kernel workspace, handed out per thread through
+// OpKernelContext::GetTempSpaceAllocator (see session.reusable_scratch_buffer_max_mb).
+//
+// One block grows to the high-water workspace size of the kernels executed on the owning
+// thread; allocations bump an offset and frees rewind it once everything handed out has been
+// returned. Since kernels release their temp buffers before Compute() returns, every node
+// reuses the same block without touching the shared BFC arena (no bin bookkeeping, no global
+// arena mutex on the hot path). Requests that don't fit in the block fall through to the
+// backing allocator.
+//
+// Every allocation carries a header identifying the owning instance, so a buffer freed on a
+// different thread than it was allocated on is routed back to its owner; all bookkeeping is
+// guarded by a (virtually uncontended) per-instance mutex.
+class ScratchBufferAllocator final : public IAllocator {
+ public:
+  ScratchBufferAllocator(AllocatorPtr backing_allocator, size_t max_block_bytes);
+  ~ScratchBufferAllocator() override;
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScratchBufferAllocator);
+
+ private:
+  // Header placed kHeaderBytes before every returned pointer. kHeaderBytes keeps the user
+  // pointer at the same alignment the backing allocator provides.
+  struct Header {
+    ScratchBufferAllocator* owner;
+    bool from_block;
+  };
+  static constexpr size_t kHeaderBytes = kAllocAlignment;
+
+  void FreeOwned(void* p, const Header& header);
+
+  AllocatorPtr backing_allocator_;
+  const size_t max_block_bytes_;
+
+  std::mutex mutex_;
+  void* block_{nullptr};
+  size_t block_bytes_{0};
+  size_t offset_{0};
+  size_t outstanding_{0};
+  // largest total block usage seen while the block was exhausted; drives the next grow
+  size_t wanted_bytes_{0};
+};
+
+}  // namespace onnxruntime
@@ -35,6 +35,10 @@ struct AllocPlanPerValue {
   // reused_buffer is valid only if alloc_kind == kReuse. It indicates
   // which OrtValue's buffer must be reused for this OrtValue.
   OrtValueIndex reused_buffer{0};
+  // If true this CPU value has a long def-use gap and is served from the session's secondary
+  // (file-backed) allocator so its pages can be reclaimed while cold. See
+  // session.offload_min_def_use_gap_nodes.
+  bool use_secondary_allocator{false};
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   IntervalT life_interval{0, 0};
   IntervalT allocate_interval{0, 0};
@@ -117,6 +121,9 @@ struct SequentialExecutionPlan : public ExecutionPlanBase {
                            const bool& terminate_flag,
                            bool& continue_flag) = 0;
     virtual std::string ToString() const = 0;
+    // type tag for the step-fusion pass; RTTI is disabled in most builds so dynamic_cast
+    // is not an option here
+    virtual bool IsLaunchKernelStep() const { return false; }
     inline NodeIndex GetNodeIndex() { return node_index_; }
 
    protected:
@@ -12,6 +12,7 @@
 #include "core/framework/allocation_planner.h"
 #include "core/framework/execution_frame.h"
 #include "core/framework/resource_accountant.h"
+#include "core/framework/run_priority.h"
 #include "core/framework/stream_execution_context.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
@@ -435,6 +436,17 @@ onnxruntime::Status ExecuteKernel(StreamExecutionContext& ctx,
                                   size_t stream_idx,
                                   const bool& terminate_flag,
                                   SessionScope& session_scope) {
+  // preemption point: a thread driving a low-priority run steps aside while a high-priority
+  // run is in flight (see run.priority)
+  while (RunPriorityScope::ShouldYieldToHigherPriority() && !terminate_flag) {
+    std::this_thread::yield();
+  }
+
+  // Materialize any lazily constructed subgraph session states before the owning
+  // control-flow node runs (see session.lazy_subgraph_session_state). One atomic load
+  // when nothing is pending.
+  ORT_RETURN_IF_ERROR(ctx.GetSessionState().EnsureSubgraphSessionStatesFinalized(idx));
+
   auto* p_kernel = ctx.GetSessionState().GetKernel(idx);
   if (p_kernel->KernelDef().OpName() == "YieldOp") {
     // Do not execute YieldOp (it is an no-op anyways).
@@ -489,7 +501,19 @@ onnxruntime::Status ExecuteKernel(StreamExecutionContext& ctx,
         status = kernel_ctx.SetOutputMLValue(0, cache.get()->at(cached_arg_name));
       }
 #else
-      status = p_kernel->Compute(&kernel_ctx);
+      if (ctx.GetSessionState().NodeDurationMeasurementEnabled()) {
+        // feed the adaptive per-node parallelism decision (see
+        // session.adaptive_intra_op_threshold_us) and/or the per-node duration histograms
+        // (see session.collect_node_duration_histograms) with the observed execution time
+        const auto compute_start = std::chrono::steady_clock::now();
+        status = p_kernel->Compute(&kernel_ctx);
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - compute_start)
+                                .count();
+        ctx.GetSessionState().RecordNodeDuration(idx, static_cast<uint64_t>(micros));
+      } else {
+        status = p_kernel->Compute(&kernel_ctx);
+      }
 
 #if !defined(ORT_MINIMAL_BUILD)
       auto* node_stats_recorder = ctx.GetSessionState().GetNodeStatsRecorder();
@@ -643,6 +667,10 @@ onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<
       // ctx.CompleteTask();
     } else {
       concurrency::ThreadPool::Schedule(tp, [i, &ctx, &terminate_flag, &session_scope]() {
+        // count this stream as an active graph-level task so intra-op loops it spawns divide
+        // the workers among concurrent streams (see ThreadPool::BeginNestedRegion)
+        concurrency::ThreadPool::NestedRegionScope nested_region_scope(
+            ctx.GetSessionState().GetThreadPool());
         RunSince(i, ctx, session_scope, terminate_flag, 0);
       });
     }
@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/session_plan_cache.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+
+#include "core/framework/murmurhash3.h"
+#include "core/graph/graph_viewer.h"
+#include "core/session/onnxruntime_c_api.h"
+
+namespace onnxruntime {
+
+namespace {
+
+constexpr uint32_t kPlanCacheMagic = 0x5452'4f50;  // 'PORT'
+constexpr uint32_t kPlanCacheVersion = 1;
+
+struct PlanCacheHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t model_hash;
+  uint64_t num_values;
+};
+
+template <typename T>
+void WritePod(std::ofstream& out, const T& value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadPod(std::ifstream& in, T& value) {
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return in.good();
+}
+
+}  // namespace
+
+uint64_t SessionPlanCache::ComputeModelHash(const GraphViewer& graph_viewer) {
+  uint32_t hash[4] = {0, 0, 0, 0};
+  auto hash_string = [&hash](const std::string& str) {
+    MurmurHash3::x86_128(str.data(), str.size(), hash[0], &hash);
+  };
+
+  // The reuse decisions depend on everything the planner sees: graph structure, attributes,
+  // types and shapes (via the serialized NodeProto and each NodeArg's TypeProto), the EP
+  // assignment, and the planner implementation itself (folded in via ORT_API_VERSION, bumped
+  // every release). Hashing names alone would replay stale decisions after a re-export that
+  // keeps names but changes shapes.
+  const uint32_t ort_api_version = ORT_API_VERSION;
+  MurmurHash3::x86_128(&ort_api_version, sizeof(ort_api_version), hash[0], &hash);
+
+  for (NodeIndex node_index : graph_viewer.GetNodesInTopologicalOrder()) {
+    const Node& node = *graph_viewer.GetNode(node_index);
+
+    ONNX_NAMESPACE::NodeProto node_proto;
+    node.ToProto(node_proto);
+    hash_string(node_proto.SerializeAsString());
+    hash_string(node.GetExecutionProviderType());
+
+    auto hash_def = [&](const NodeArg* def) {
+      hash_string(def->Name());
+      if (const ONNX_NAMESPACE::TypeProto* type_proto = def->TypeAsProto(); type_proto != nullptr) {
+        hash_string(type_proto->SerializeAsString());
+      }
+    };
+    for (const auto* def : node.InputDefs()) {
+      hash_def(def);
+    }
+    for (const auto* def : node.OutputDefs()) {
+      hash_def(def);
+    }
+  }
+
+  // GetAllInitializedTensors is an unordered container; sort the names so the hash is
+  // stable across processes.
+  std::vector<std::string_view> initializer_names;
+  initializer_names.reserve(graph_viewer.GetAllInitializedTensors().size());
+  for (const auto& [name, tensor_proto] : graph_viewer.GetAllInitializedTensors()) {
+    ORT_UNUSED_PARAMETER(tensor_proto);
+    initializer_names.push_back(name);
+  }
+  std::sort(initializer_names.begin(), initializer_names.end());
+  for (const auto& name : initializer_names) {
+    MurmurHash3::x86_128(name.data(), name.size(), hash[0], &hash);
+  }
+
+  return (static_cast<uint64_t>(hash[0]) << 32) | hash[1];
+}
+
+Status SessionPlanCache::Load(const PathString& path, uint64_t expected_model_hash,
+                              CachedReusePlan& cached_plan) {
+  cached_plan.values.clear();
+
+  std::error_code ec;
+  if (!std::filesystem::exists(std::filesystem::path{path}, ec)) {
+    return Status::OK();
+  }
+
+  std::ifstream in{std::filesystem::path{path}, std::ios::binary};
+  ORT_RETURN_IF_NOT(in.good(), "Failed to open execution plan cache file for reading.");
+
+  PlanCacheHeader header;
+  ORT_RETURN_IF_NOT(ReadPod(in, header), "Execution plan cache file is truncated.");
+  ORT_RETURN_IF_NOT(header.magic == kPlanCacheMagic && header.version == kPlanCacheVersion,
+                    "Execution plan cache file has an unrecognized format.");
+
+  if (header.model_hash != expected_model_hash) {
+    // The model (or its EP assignment) changed since the artifact was written. Treat as a miss
+    // so the plan is recomputed and the artifact refreshed.
+    return Status::OK();
+  }
+
+  std::vector<CachedReusePlan::ValueEntry> values;
+  values.resize(header.num_values);
+  for (auto& entry : values) {
+    int32_t alloc_kind = 0;
+    int32_t reused_buffer = 0;
+    ORT_RETURN_IF_NOT(ReadPod(in, alloc_kind) && ReadPod(in, reused_buffer),
+                      "Execution plan cache file is truncated.");
+    ORT_RETURN_IF_NOT(alloc_kind >= static_cast<int32_t>(AllocKind::kNotSet) &&
+                          alloc_kind <= static_cast<int32_t>(AllocKind::kAllocatedExternally),
+                      "Execution plan cache file contains an out of range alloc kind.");
+    entry.alloc_kind = static_cast<AllocKind>(alloc_kind);
+    entry.reused_buffer = reused_buffer;
+    ORT_RETURN_IF_NOT(entry.reused_buffer >= 0 &&
+                          static_cast<uint64_t>(entry.reused_buffer) < header.num_values,
+                      "Execution plan cache file contains an out of range buffer index.");
+  }
+
+  cached_plan.model_hash = header.model_hash;
+  cached_plan.values = std::move(values);
+  return Status::OK();
+}
+
+Status SessionPlanCache::Save(const PathString& path, uint64_t model_hash,
+                              const SequentialExecutionPlan& plan) {
+  std::filesystem::path final_path{path};
+  std::filesystem::path tmp_path{final_path};
+  tmp_path += ORT_TSTR(".tmp");
+
+  {
+    std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+    ORT_RETURN_IF_NOT(out.good(), "Failed to open execution plan cache file for writing.");
+
+    PlanCacheHeader header{kPlanCacheMagic, kPlanCacheVersion, model_hash,
+                           plan.allocation_plan.size()};
+    WritePod(out, header);
+
+    for (const auto& per_value : plan.allocation_plan) {
+      WritePod(out, static_cast<int32_t>(per_value.alloc_kind));
+      WritePod(out, static_cast<int32_t>(per_value.reused_buffer));
+    }
+
+    ORT_RETURN_IF_NOT(out.good(), "Failed to write execution plan cache file.");
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tmp_path, final_path, ec);
+  ORT_RETURN_IF_NOT(!ec, "Failed to move execution plan cache file into place: ", ec.message());
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
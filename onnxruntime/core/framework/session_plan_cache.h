@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/path_string.h"
+#include "core/framework/alloc_kind.h"
+#include "core/framework/sequential_execution_plan.h"
+
+namespace onnxruntime {
+
+class GraphViewer;
+
+// The subset of the allocation plan that is expensive to recompute but cheap to serialize.
+// The buffer reuse analysis performed by SequentialPlanner is deterministic for a given
+// (model, EP assignment) pair, so its per-OrtValue decisions can be captured once and
+// replayed on subsequent process startups. Entries are indexed by OrtValueIndex.
+struct CachedReusePlan {
+  struct ValueEntry {
+    AllocKind alloc_kind{AllocKind::kNotSet};
+    OrtValueIndex reused_buffer{0};
+  };
+
+  uint64_t model_hash{0};
+  std::vector<ValueEntry> values;
+
+  bool Empty() const { return values.empty(); }
+};
+
+// Persists the reuse decisions of a finalized SequentialExecutionPlan to disk so that
+// subsequent session initializations against the same model can skip the reuse analysis.
+// The artifact is validated by a hash over the graph topology; a mismatch is treated the
+// same as a missing file and the plan is recomputed (and the artifact refreshed).
+class SessionPlanCache {
+ public:
+  // Hash over the graph topology (node op types, names, edges and initializer names) that
+  // identifies the planning input. Kernel assignment changes are covered transitively as
+  // they are a pure function of the (graph, registered EPs) pair for a given build.
+  static uint64_t ComputeModelHash(const GraphViewer& graph_viewer);
+
+  // Loads a cached reuse plan from 'path'. A missing file or a model hash mismatch is not
+  // an error: 'cached_plan' is left empty and Status::OK() is returned. A present but
+  // malformed file fails with a FAIL status so corruption is surfaced rather than applied.
+  static Status Load(const PathString& path, uint64_t expected_model_hash, CachedReusePlan& cached_plan);
+
+  // Serializes the reuse decisions of 'plan' to 'path'. Writes to a temporary file first
+  // and renames into place so concurrent readers never observe a partial artifact.
+  static Status Save(const PathString& path, uint64_t model_hash, const SequentialExecutionPlan& plan);
+};
+
+}  // namespace onnxruntime
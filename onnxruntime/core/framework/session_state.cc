@@ -3,6 +3,9 @@
 
 #include "core/framework/session_state.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
 #include <sstream>
 
 #include <mutex>
@@ -10,11 +13,18 @@
 #include "core/common/safeint.h"
 #include "core/flatbuffers/schema/ort.fbs.h"
 #include "core/framework/allocator.h"
+#include "core/framework/murmurhash3.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_pattern_planner.h"
+#include "core/common/path_string.h"
+#include "core/framework/file_backed_allocator.h"
 #include "core/framework/prepacked_weights_container.h"
+#include "core/framework/scratch_buffer_allocator.h"
+#include "core/framework/session_plan_cache.h"
+#include "core/framework/mldata_type_utils.h"
 #include "core/framework/session_state_utils.h"
+#include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
 #include "core/providers/cpu/controlflow/utils.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
@@ -103,6 +113,22 @@ SessionState::SessionState(Graph& graph,
 {
   enable_mem_pattern_ = sess_options_.enable_mem_pattern &&
                         sess_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL;
+  memory_pattern_shape_bucket_size_ = std::atoi(
+      sess_options_.config_options
+          .GetConfigOrDefault(kOrtSessionOptionsMemoryPatternShapeBucketSize, "0")
+          .c_str());
+  adaptive_intra_op_threshold_us_ = std::atoi(
+      sess_options_.config_options
+          .GetConfigOrDefault(kOrtSessionOptionsAdaptiveIntraOpThresholdUs, "0")
+          .c_str());
+  collect_node_duration_histograms_ =
+      sess_options_.config_options
+          .GetConfigOrDefault(kOrtSessionOptionsCollectNodeDurationHistograms, "0") == "1";
+  scratch_buffer_max_bytes_ =
+      static_cast<size_t>(std::max(0, std::atoi(sess_options_.config_options
+                                                    .GetConfigOrDefault(kOrtSessionOptionsReusableScratchBufferMaxMb, "0")
+                                                    .c_str()))) *
+      1024 * 1024;
   if (parent_allocators) {
     allocators_ = parent_allocators;
   } else {
@@ -240,8 +266,28 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
     }
     session_kernels_.clear();
     session_kernels_.resize(max_nodeid + 1);
-    for (const auto& node : nodes) {
-      // construct and save the kernels
+
+    if (adaptive_intra_op_threshold_us_ > 0 || collect_node_duration_histograms_) {
+      num_nodes_for_duration_stats_ = max_nodeid + 1;
+      if (adaptive_intra_op_threshold_us_ > 0) {
+        node_duration_ema_us_ = std::make_unique<std::atomic<uint32_t>[]>(num_nodes_for_duration_stats_);
+        for (size_t i = 0; i < num_nodes_for_duration_stats_; ++i) {
+          node_duration_ema_us_[i].store(0, std::memory_order_relaxed);
+        }
+      }
+      if (collect_node_duration_histograms_) {
+        const size_t num_counters = num_nodes_for_duration_stats_ * kNodeDurationHistogramBuckets;
+        node_duration_histograms_ = std::make_unique<std::atomic<uint64_t>[]>(num_counters);
+        for (size_t i = 0; i < num_counters; ++i) {
+          node_duration_histograms_[i].store(0, std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // construct and save a kernel for one node. Each invocation writes to a distinct
+    // session_kernels_ slot and otherwise only reads shared state, so independent nodes can be
+    // processed concurrently.
+    auto create_kernel_for_node = [this, &kernel_registry_manager](const Node& node) -> Status {
       const KernelCreateInfo& kci = GetNodeKernelCreateInfo(node.Index());
 
       // the execution provider was required to be valid to find the KernelCreateInfo so we don't need to check it here
@@ -249,7 +295,57 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
       const IExecutionProvider& exec_provider = *execution_providers_.Get(exec_provider_name);
 
       // assumes vector is already resize()'ed to the number of nodes in the graph
-      ORT_RETURN_IF_ERROR(kernel_registry_manager.CreateKernel(node, exec_provider, *this, kci, session_kernels_[node.Index()]));
+      return kernel_registry_manager.CreateKernel(node, exec_provider, *this, kci, session_kernels_[node.Index()]);
+    };
+
+    int parallel_degree = 0;
+    {
+      const std::string degree_str =
+          sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsParallelInitializeDegree, "0");
+      parallel_degree = std::atoi(degree_str.c_str());
+    }
+
+    concurrency::ThreadPool* init_pool = inter_op_thread_pool_ != nullptr ? inter_op_thread_pool_ : thread_pool_;
+    std::vector<const Node*> node_ptrs;
+    node_ptrs.reserve(max_nodeid + 1);
+    for (const auto& node : nodes) {
+      node_ptrs.push_back(&node);
+    }
+
+    const auto num_shards = static_cast<std::ptrdiff_t>(
+        std::min<size_t>(static_cast<size_t>(std::max(parallel_degree, 0)), node_ptrs.size()));
+    if (init_pool != nullptr && num_shards > 1) {
+      std::vector<Status> shard_status(static_cast<size_t>(num_shards));
+      concurrency::ThreadPool::TrySimpleParallelFor(
+          init_pool, num_shards,
+          [&node_ptrs, &shard_status, &create_kernel_for_node, num_shards](std::ptrdiff_t shard) {
+            for (size_t i = static_cast<size_t>(shard); i < node_ptrs.size();
+                 i += static_cast<size_t>(num_shards)) {
+              // kernel constructors may throw (ORT_ENFORCE on malformed attributes); on the
+              // serial path Initialize()'s ORT_TRY turns that into a Status, but an exception
+              // escaping a pool worker would terminate the process
+              Status status;
+              ORT_TRY {
+                status = create_kernel_for_node(*node_ptrs[i]);
+              }
+              ORT_CATCH(const std::exception& e) {
+                ORT_HANDLE_EXCEPTION([&]() {
+                  status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exception during kernel creation: ", e.what());
+                });
+              }
+              if (!status.IsOK()) {
+                shard_status[static_cast<size_t>(shard)] = std::move(status);
+                return;
+              }
+            }
+          });
+      for (auto& status : shard_status) {
+        ORT_RETURN_IF_ERROR(status);
+      }
+    } else {
+      for (const Node* node : node_ptrs) {
+        ORT_RETURN_IF_ERROR(create_kernel_for_node(*node));
+      }
     }
   }
   node_index_info_.emplace(*graph_viewer_, ort_value_name_idx_map_);
@@ -416,6 +512,49 @@ static std::string GenerateKeyForPrepackedWeightsMap(const std::string& op_type,
   return ss_1.str();
 }
 
+// Key for the disk-backed pre-packed weights cache. Unlike the in-memory sharing key above it
+// must be computable *before* PrePack() runs (so a hit can skip packing), so it hashes the
+// packing inputs: the weight's content, the op type, the node's attributes (sorted by name for
+// a stable order) and the consuming input slot. The CPU dispatch identity is appended by the
+// container's file naming.
+static std::string GenerateKeyForPrepackedWeightsDiskCache(const Node& node, int input_idx,
+                                                           const Tensor& weight) {
+  uint32_t hash[4] = {0, 0, 0, 0};
+  auto hash_bytes = [&hash](const void* data, size_t len) {
+    MurmurHash3::x86_128(data, len, hash[0], &hash);
+  };
+
+  hash_bytes(weight.DataRaw(), weight.SizeInBytes());
+
+  // dims and element type disambiguate byte-identical weights of different geometry
+  // (e.g. transposed all-zero tensors), which pack differently
+  const auto dims = weight.Shape().GetDims();
+  hash_bytes(dims.data(), dims.size() * sizeof(int64_t));
+  const int32_t element_type = weight.GetElementType();
+  hash_bytes(&element_type, sizeof(element_type));
+
+  InlinedVector<std::reference_wrapper<const std::string>> attr_names;
+  const auto& attributes = node.GetAttributes();
+  attr_names.reserve(attributes.size());
+  for (const auto& [name, attr_proto] : attributes) {
+    ORT_UNUSED_PARAMETER(attr_proto);
+    attr_names.push_back(std::cref(name));
+  }
+  std::sort(attr_names.begin(), attr_names.end(),
+            [](const std::string& a, const std::string& b) { return a < b; });
+  for (const std::string& attr_name : attr_names) {
+    hash_bytes(attr_name.data(), attr_name.size());
+    const std::string serialized_attr = attributes.at(attr_name).SerializeAsString();
+    hash_bytes(serialized_attr.data(), serialized_attr.size());
+  }
+
+  std::ostringstream key;
+  key << node.OpType() << "+in" << input_idx << "+" << std::hex << std::setfill('0')
+      << std::setw(8) << hash[0] << std::setw(8) << hash[1] << std::setw(8) << hash[2]
+      << std::setw(8) << hash[3];
+  return key.str();
+}
+
 Status SessionState::PrepackConstantInitializedTensors(
     InlinedHashMap<std::string, size_t>& constant_initializers_use_count,
     const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map) {
@@ -455,6 +594,32 @@ Status SessionState::PrepackConstantInitializedTensors(
                   AllocatorPtr allocator_for_caching = prepacked_weights_container_->GetOrCreateAllocator(CPU);
                   ORT_ENFORCE(allocator_for_caching.get() != nullptr);
 
+                  // The disk cache is consulted before PrePack() runs, so a cache hit skips the
+                  // packing work entirely - that is the whole point of the disk tier. Its key is
+                  // therefore derived from what is known up front (weight content, op type, node
+                  // attributes and input slot; the CPU dispatch identity is folded in by the
+                  // container), unlike the in-memory sharing key below which hashes the packed
+                  // output and so can only be computed after packing.
+                  std::string disk_cache_key;
+                  if (prepacked_weights_container_->DiskCacheEnabled()) {
+                    disk_cache_key = GenerateKeyForPrepackedWeightsDiskCache(node, input_idx,
+                                                                             const_initialized_tensor);
+                    if (prepacked_weights_container_->HasWeight(disk_cache_key) ||
+                        prepacked_weights_container_->TryLoadFromDiskCache(disk_cache_key)) {
+                      LOGS(logger_, INFO) << "Using disk-cached pre-packed weight for constant initializer: "
+                                          << input_name << " used in the node: " << node.Name()
+                                          << " which is of op type: " << node.OpType();
+
+                      const auto& disk_cached_weights =
+                          prepacked_weights_container_->GetWeight(disk_cache_key);
+                      ORT_RETURN_IF_ERROR(KernelUseSharedPrePackedBuffers(*kernel, input_idx,
+                                                                          disk_cached_weights,
+                                                                          node.Name()));
+                      ++used_shared_pre_packed_weights_counter_;
+                      is_packed = true;
+                    }
+                  }
+
                   PrePackedWeights weights_to_be_filled_in;
                   // The reason we invoke PrePack() before looking into the container for any pre-packed weight
                   // cached by another instance of the same op_type (for the same constant initializer) is because
@@ -462,11 +627,14 @@ Status SessionState::PrepackConstantInitializedTensors(
                   // pre-packed  weight with the pre-packed weight generated by this instance of the same op_type
                   // because other static properties of the node like node attributes could play a role in the
                   // pre-packed weights' contents.
-                  ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, allocator_for_caching,
-                                                      is_packed,
-                                                      &weights_to_be_filled_in));
+                  bool packed_from_disk_cache = is_packed;
+                  if (!packed_from_disk_cache) {
+                    ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, allocator_for_caching,
+                                                        is_packed,
+                                                        &weights_to_be_filled_in));
+                  }
 
-                  if (is_packed) {
+                  if (is_packed && !packed_from_disk_cache) {
                     // BUG CHECK: Ensure that the kernel has filled in the pre-packed weight
                     // to be cached if the weight was pre-packed
                     ORT_ENFORCE(weights_to_be_filled_in.buffers_.size() > 0,
@@ -503,6 +671,12 @@ Status SessionState::PrepackConstantInitializedTensors(
 
                       ++used_shared_pre_packed_weights_counter_;
 
+                      // make sure this node's pre-pack key is also on disk so the next cold
+                      // start skips PrePack() for it as well
+                      if (!disk_cache_key.empty()) {
+                        prepacked_weights_container_->SaveWeightToDiskCache(disk_cache_key, prepacked_shared);
+                      }
+
                       // Write references to what is stored in the shared container
                       // and release memory mapped entries this container may have loaded from disk
                       std::ignore = prepacked_for_graph->ReplaceWithReferenceIfSaving(input_name,
@@ -540,6 +714,11 @@ Status SessionState::PrepackConstantInitializedTensors(
 
                       const auto& shared_prepacked = prepacked_weights_container_->GetWeight(
                           prepacked_weights_container_key);
+
+                      // persist under the pre-pack key so the next cold start skips PrePack()
+                      if (!disk_cache_key.empty()) {
+                        prepacked_weights_container_->SaveWeightToDiskCache(disk_cache_key, shared_prepacked);
+                      }
                       ORT_RETURN_IF_ERROR(KernelUseSharedPrePackedBuffers(*kernel, input_idx,
                                                                           shared_prepacked,
                                                                           node.Name()));
@@ -642,7 +821,6 @@ CalculateMemoryPatternsKey(const gsl::span<const OrtValue>& tensor_inputs) {
   return key;
 }
 
-#ifdef ENABLE_TRAINING
 namespace {
 Status ResolveDimParams(const GraphViewer& graph,
                         const InlinedHashMap<std::string, TensorShape>& feeds,
@@ -834,8 +1012,10 @@ Status SessionState::GeneratePatternGroupCache(gsl::span<const OrtValue> tensor_
       size_t size = 0;
       TryCalculateSizeFromResolvedShape(ml_value_idx, resolved_shapes, size);
 
-      // Plan memory if conditions are met.
+      // Plan memory if conditions are met. Offloaded values are excluded: they must come from
+      // the secondary allocator, not the pattern slab.
       if (exe_plan->allocation_plan[ml_value_idx].alloc_kind == AllocKind::kAllocate &&
+          !exe_plan->allocation_plan[ml_value_idx].use_secondary_allocator &&
           ml_data_type != DataTypeImpl::GetType<std::string>() && size != 0) {
         size_t aligned_size = 0;
         if (!IAllocator::CalcMemSizeForArrayWithAlignment<kAllocAlignment>(size, ml_data_type->Size(), &aligned_size)) {
@@ -874,7 +1054,33 @@ Status SessionState::GeneratePatternGroupCache(gsl::span<const OrtValue> tensor_
   return Status::OK();
 }
 
-#endif
+Status SessionState::PrimeMemoryPatterns(gsl::span<const OrtValue> tensor_inputs,
+                                         gsl::span<const int> feed_mlvalue_idxs,
+                                         InlinedHashMap<OrtDevice, size_t>& planned_peak_sizes) {
+  planned_peak_sizes.clear();
+  if (!enable_mem_pattern_) {
+    return Status::OK();
+  }
+
+  const int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
+  std::lock_guard<std::mutex> lock(mem_patterns_lock_);
+  auto it = mem_patterns_.find(key);
+  if (it == mem_patterns_.end()) {
+    MemoryPatternGroup mem_patterns;
+    InlinedHashMap<int, TensorShape> inferred_shapes;
+    ORT_RETURN_IF_ERROR(GeneratePatternGroupCache(tensor_inputs, feed_mlvalue_idxs,
+                                                  mem_patterns, inferred_shapes));
+    it = mem_patterns_.insert_or_assign(key, std::move(mem_patterns)).first;
+    shape_patterns_.insert_or_assign(key, std::move(inferred_shapes));
+  }
+
+  const MemoryPatternGroup& group = it->second;
+  for (size_t i = 0; i < group.locations.size(); ++i) {
+    planned_peak_sizes[group.locations[i]] = group.patterns[i].PeakSize();
+  }
+
+  return Status::OK();
+}
 
 // MemoryPatternGroup pointer is cached. It only inserted upon creation
 // and is not updated if already present.
@@ -883,6 +1089,59 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(
     gsl::span<const int> feed_mlvalue_idxs,
     const InlinedHashMap<int, TensorShape>*& out_inferred_shapes) const {
   out_inferred_shapes = nullptr;
+
+  // With shape bucketing, dynamic input dims are rounded up to the bucket size so runs with
+  // similar shapes share one pattern sized for the bucket ceiling. Inferred shapes are not
+  // exposed in this mode: actual sizes are computed at run time and fit into the (possibly
+  // larger) pattern blocks, which ExecutionFrame allows when bucketing is enabled.
+  if (memory_pattern_shape_bucket_size_ > 1) {
+    const int64_t bucket = memory_pattern_shape_bucket_size_;
+    InlinedVector<OrtValue> bucketed_inputs;
+    bucketed_inputs.reserve(tensor_inputs.size());
+    for (size_t i = 0; i < tensor_inputs.size(); ++i) {
+      const Tensor& tensor = tensor_inputs[i].Get<Tensor>();
+
+      std::string input_name;
+      const ONNX_NAMESPACE::TensorShapeProto* declared_shape = nullptr;
+      if (ort_value_name_idx_map_.GetName(feed_mlvalue_idxs[i], input_name).IsOK()) {
+        if (const NodeArg* node_arg = graph_viewer_->GetGraph().GetNodeArg(input_name); node_arg != nullptr) {
+          declared_shape = node_arg->Shape();
+        }
+      }
+
+      auto dims = tensor.Shape().AsShapeVector();
+      for (size_t j = 0; j < dims.size(); ++j) {
+        // only bucket dims that are symbolic in the model: static dims would just waste memory
+        const bool is_dynamic_dim = declared_shape != nullptr &&
+                                    j < static_cast<size_t>(declared_shape->dim_size()) &&
+                                    declared_shape->dim(static_cast<int>(j)).has_dim_param();
+        if (is_dynamic_dim && dims[j] > 0) {
+          dims[j] = ((dims[j] + bucket - 1) / bucket) * bucket;
+        }
+      }
+
+      Tensor shape_only(tensor.DataType(), TensorShape(dims), nullptr, tensor.Location());
+      OrtValue value;
+      Tensor::InitOrtValue(std::move(shape_only), value);
+      bucketed_inputs.push_back(std::move(value));
+    }
+
+    const int64_t bucketed_key = CalculateMemoryPatternsKey(bucketed_inputs);
+    std::lock_guard<std::mutex> lock(mem_patterns_lock_);
+    auto bucketed_it = mem_patterns_.find(bucketed_key);
+    if (bucketed_it == mem_patterns_.end()) {
+      MemoryPatternGroup mem_patterns;
+      InlinedHashMap<int, TensorShape> bucketed_inferred_shapes;  // intentionally discarded
+      if (!GeneratePatternGroupCache(bucketed_inputs, feed_mlvalue_idxs, mem_patterns,
+                                     bucketed_inferred_shapes)
+               .IsOK()) {
+        return nullptr;
+      }
+      bucketed_it = mem_patterns_.insert_or_assign(bucketed_key, std::move(mem_patterns)).first;
+    }
+    return &bucketed_it->second;
+  }
+
   int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
   std::lock_guard<std::mutex> lock(mem_patterns_lock_);
   auto it = mem_patterns_.find(key);
@@ -1517,6 +1776,26 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   SequentialPlannerContext context(session_options.execution_mode,
                                    session_options.execution_order,
                                    session_options.enable_mem_reuse);
+  context.SetOffloadMinDefUseGap(std::atoi(
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsOffloadMinDefUseGapNodes, "0").c_str()));
+
+  // Attempt to replay a previously persisted execution plan. Subgraph plans are not cached:
+  // they are small and their OrtValue index spaces are only meaningful within a parent plan.
+  PathString plan_cache_path;
+  uint64_t plan_cache_model_hash = 0;
+  CachedReusePlan cached_reuse_plan;
+  if (parent_node == nullptr) {
+    plan_cache_path = ToPathString(session_options.config_options.GetConfigOrDefault(
+        kOrtSessionOptionsExecutionPlanCachePath, ""));
+    if (!plan_cache_path.empty()) {
+      plan_cache_model_hash = SessionPlanCache::ComputeModelHash(*graph_viewer_);
+      ORT_RETURN_IF_ERROR(SessionPlanCache::Load(plan_cache_path, plan_cache_model_hash, cached_reuse_plan));
+      if (!cached_reuse_plan.Empty()) {
+        LOGS(Logger(), INFO) << "Replaying execution plan from cache.";
+        context.SetCachedReusePlan(&cached_reuse_plan);
+      }
+    }
+  }
 
 #ifdef _WIN32
 
@@ -1550,6 +1829,15 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
                            "SessionState finalize is canceled due to user request");
   }
 
+  // Refresh the plan cache artifact if it was missing or stale. A failure to persist is logged
+  // but doesn't fail initialization since the computed plan is already in hand.
+  if (!plan_cache_path.empty() && cached_reuse_plan.Empty()) {
+    auto save_status = SessionPlanCache::Save(plan_cache_path, plan_cache_model_hash, *p_seq_exec_plan_);
+    if (!save_status.IsOK()) {
+      LOGS(Logger(), WARNING) << "Failed to save execution plan cache: " << save_status.ErrorMessage();
+    }
+  }
+
   // Record the allocation plan
 
   // Uncomment the below to dump the allocation plan to std::cout
@@ -1629,7 +1917,9 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
         return Status::OK();
       },
       logger_, data_transfer_mgr_, external_data_loader_mgr_, *p_seq_exec_plan_, session_options,
-      memory_profile_func, name_to_buffered_tensor_, graph_.GetPrepacked()));
+      memory_profile_func, name_to_buffered_tensor_, graph_.GetPrepacked(),
+      inter_op_thread_pool_ != nullptr ? inter_op_thread_pool_ : thread_pool_,
+      shared_initializer_pool_));
 
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Record Weight allocation info on device
@@ -1660,6 +1950,12 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   SessionOptions subgraph_session_options(session_options);
   subgraph_session_options.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
 
+  // With lazy subgraph construction, record everything needed to finalize each subgraph and do
+  // the work on the owning node's first execution instead. Models with many never-taken
+  // control-flow branches then skip the corresponding planning/kernel/initializer work entirely.
+  const bool lazy_subgraphs =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsLazySubgraphSessionState, "0") == "1";
+
   for (const auto& node_to_subgraph_ss : subgraph_session_states_) {
     Node& node = *graph_.GetNode(node_to_subgraph_ss.first);
 
@@ -1673,31 +1969,29 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 
       SessionState& subgraph_session_state = *entry->second;
 
-      // recurse
+      if (lazy_subgraphs) {
+        // constant_initializers_use_count refers to a caller-owned stack map, so one copy is
+        // taken on the first deferral and shared by all deferred finalizes: decrements made by
+        // one lazily-finalized subgraph must stay visible to the others for the release
+        // bookkeeping to ever reach zero.
+        if (num_deferred_subgraphs_.load(std::memory_order_relaxed) == 0 &&
+            deferred_subgraph_finalizes_.empty()) {
+          deferred_constant_initializers_use_count_ = constant_initializers_use_count;
+        }
+        deferred_subgraph_finalizes_[node.Index()].push_back(
+            DeferredSubgraphFinalize{attr_name, graph_location, &kernel_registry_manager,
+                                     subgraph_session_options, remove_initializers,
+                                     save_prepacked_initializers});
+        num_deferred_subgraphs_.fetch_add(1, std::memory_order_release);
+        continue;
+      }
 
-      // We need to create graph info for the subgraphs because information accumulated there
-      // is used in OuterScopeNodeArgLocationAccumulator()
-      subgraph_session_state.CreateGraphInfo(save_prepacked_initializers);
-
-      InlinedHashMap<OrtValueName, OrtDevice> subgraph_outer_scope_node_arg_to_location_map;
-      ORT_RETURN_IF_ERROR(OuterScopeNodeArgLocationAccumulator(*p_seq_exec_plan_, GetOrtValueNameIdxMap(),
-                                                               node,
-                                                               subgraph_session_state.GetGraphViewer(),
-                                                               subgraph_outer_scope_node_arg_to_location_map));
-
-      ORT_RETURN_IF_ERROR(subgraph_session_state.FinalizeSessionStateImpl(
-          graph_location, kernel_registry_manager, &node, subgraph_session_options, remove_initializers,
-          save_prepacked_initializers,
-          constant_initializers_use_count, subgraph_outer_scope_node_arg_to_location_map, true));
-
-      // setup all the info for handling the feeds and fetches used in subgraph execution
-      auto* p_op_kernel = GetMutableKernel(node.Index());
-      ORT_ENFORCE(p_op_kernel);
-
-      // Downcast is safe, since only control flow nodes have subgraphs
-      // (node.GetAttributeNameToMutableSubgraphMap() is non-empty)
-      auto& control_flow_kernel = static_cast<controlflow::IControlFlowKernel&>(*p_op_kernel);
-      ORT_RETURN_IF_ERROR(control_flow_kernel.SetupSubgraphExecutionInfo(*this, attr_name, subgraph_session_state));
+      // recurse
+      ORT_RETURN_IF_ERROR(FinalizeSubgraphSessionState(node, attr_name, subgraph_session_state,
+                                                       graph_location, kernel_registry_manager,
+                                                       subgraph_session_options, remove_initializers,
+                                                       save_prepacked_initializers,
+                                                       constant_initializers_use_count));
     }
 
     // TODO: Once the subgraph session states have been finalized, can we go back and plan the location of implicit
@@ -1708,6 +2002,287 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   return Status::OK();
 }
 
+InlinedVector<OrtValue> SessionState::AcquireOrtValueBuffer() const {
+  std::lock_guard<std::mutex> lock(ort_value_buffer_pool_mutex_);
+  if (!ort_value_buffer_pool_.empty()) {
+    auto buffer = std::move(ort_value_buffer_pool_.back());
+    ort_value_buffer_pool_.pop_back();
+    return buffer;
+  }
+  return {};
+}
+
+void SessionState::ReleaseOrtValueBuffer(InlinedVector<OrtValue>&& buffer) const {
+  constexpr size_t kMaxPooledBuffers = 8;
+  buffer.clear();
+  std::lock_guard<std::mutex> lock(ort_value_buffer_pool_mutex_);
+  if (ort_value_buffer_pool_.size() < kMaxPooledBuffers) {
+    ort_value_buffer_pool_.push_back(std::move(buffer));
+  }
+}
+
+AllocatorPtr SessionState::GetSecondaryCpuAllocator() const {
+  std::lock_guard<std::mutex> lock(secondary_cpu_allocator_mutex_);
+  if (secondary_cpu_allocator_ == nullptr) {
+    secondary_cpu_allocator_ = std::make_shared<FileBackedAllocator>(
+        sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsOffloadDirectory, ""));
+  }
+  return secondary_cpu_allocator_;
+}
+
+concurrency::ThreadPool* SessionState::GetThreadPoolForNode(NodeIndex node_index) const noexcept {
+  if (!AdaptiveIntraOpParallelismEnabled() || node_index >= num_nodes_for_duration_stats_) {
+    return thread_pool_;
+  }
+
+  const uint32_t ema_us = node_duration_ema_us_[node_index].load(std::memory_order_relaxed);
+  // 0 means unmeasured: start parallel and let the measurements decide. The 2x band between
+  // demotion and (implicit) promotion avoids oscillation for nodes near the threshold.
+  if (ema_us != 0 && ema_us < static_cast<uint32_t>(adaptive_intra_op_threshold_us_)) {
+    return nullptr;
+  }
+  return thread_pool_;
+}
+
+void SessionState::RecordNodeDuration(NodeIndex node_index, uint64_t duration_us) const noexcept {
+  if (node_index >= num_nodes_for_duration_stats_) {
+    return;
+  }
+
+  if (node_duration_histograms_ != nullptr) {
+    // bucket = bit width of the duration in microseconds (0 for sub-microsecond), clamped
+    size_t bucket = 0;
+    uint64_t v = duration_us;
+    while (v > 0 && bucket < kNodeDurationHistogramBuckets - 1) {
+      v >>= 1;
+      ++bucket;
+    }
+    node_duration_histograms_[node_index * kNodeDurationHistogramBuckets + bucket].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  if (!AdaptiveIntraOpParallelismEnabled()) {
+    return;
+  }
+
+  auto& ema = node_duration_ema_us_[node_index];
+  const uint32_t sample = static_cast<uint32_t>(std::min<uint64_t>(duration_us, UINT32_MAX));
+  uint32_t current = ema.load(std::memory_order_relaxed);
+  // single-threaded samples of a demoted node are naturally larger; only let a demoted node
+  // climb back once it exceeds twice the threshold, so decisions don't oscillate
+  uint32_t updated = current == 0 ? std::max<uint32_t>(sample, 1) : (3 * current + sample) / 4;
+  if (current != 0 && current < static_cast<uint32_t>(adaptive_intra_op_threshold_us_) &&
+      updated >= static_cast<uint32_t>(adaptive_intra_op_threshold_us_) &&
+      updated < static_cast<uint32_t>(2 * adaptive_intra_op_threshold_us_)) {
+    updated = current;  // stay demoted inside the hysteresis band
+  }
+  ema.store(updated, std::memory_order_relaxed);
+}
+
+bool SessionState::GetNodeDurationHistogram(
+    NodeIndex node_index, std::array<uint64_t, kNodeDurationHistogramBuckets>& buckets) const {
+  if (node_duration_histograms_ == nullptr || node_index >= num_nodes_for_duration_stats_) {
+    return false;
+  }
+
+  const size_t base = node_index * kNodeDurationHistogramBuckets;
+  for (size_t b = 0; b < kNodeDurationHistogramBuckets; ++b) {
+    buckets[b] = node_duration_histograms_[base + b].load(std::memory_order_relaxed);
+  }
+  return true;
+}
+
+AllocatorPtr SessionState::GetThreadScratchAllocator(const AllocatorPtr& backing) const {
+  if (scratch_buffer_max_bytes_ == 0 || backing == nullptr ||
+      backing->Info().device.Type() != OrtDevice::CPU) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(scratch_allocators_mutex_);
+  auto& allocator = scratch_allocators_[std::this_thread::get_id()];
+  if (allocator == nullptr) {
+    allocator = std::make_shared<ScratchBufferAllocator>(backing, scratch_buffer_max_bytes_);
+  }
+  return allocator;
+}
+
+Status SessionState::RefreshInitializedTensor(const std::string& name, const OrtValue& new_value,
+                                              const KernelRegistryManager& kernel_registry_manager) {
+  int ort_value_index = -1;
+  ORT_RETURN_IF_ERROR(ort_value_name_idx_map_.GetIdx(name, ort_value_index));
+  ORT_RETURN_IF(!new_value.IsTensor(), "Only tensor initializers can be refreshed. Initializer: ", name);
+  const Tensor& new_tensor = new_value.Get<Tensor>();
+
+  // An initializer whose only consumers pre-packed it was released after prepacking
+  // (see PrepackConstantInitializedTensors), so it may be absent from the maps here.
+  auto it = initialized_tensors_.find(ort_value_index);
+  const bool was_released_after_prepack = it == initialized_tensors_.end();
+
+  if (!was_released_after_prepack) {
+    ORT_RETURN_IF(!it->second.IsTensor(), "Only tensor initializers can be refreshed. Initializer: ", name);
+    const Tensor& old_tensor = it->second.Get<Tensor>();
+    ORT_RETURN_IF(old_tensor.DataType() != new_tensor.DataType() ||
+                      old_tensor.Shape() != new_tensor.Shape() ||
+                      old_tensor.Location().device.Type() != new_tensor.Location().device.Type(),
+                  "Initializer '", name,
+                  "' can only be refreshed with a tensor of identical type, shape and device.");
+    it->second = new_value;
+  } else {
+    // validate against the graph definition: the original tensor is gone, but the NodeArg
+    // still records its type and shape, and the plan its location. value_type in the plan
+    // is only populated in memory-profile builds, so it can't be used here.
+    ORT_RETURN_IF(!p_seq_exec_plan_.has_value() ||
+                      static_cast<size_t>(ort_value_index) >= p_seq_exec_plan_->allocation_plan.size(),
+                  "No initialized tensor named '", name, "' in this session.");
+    const auto& per_value = p_seq_exec_plan_->allocation_plan[ort_value_index];
+    ORT_RETURN_IF(per_value.alloc_kind != AllocKind::kAllocateStatically,
+                  "No initialized tensor named '", name, "' in this session.");
+    const NodeArg* node_arg = graph_.GetNodeArg(name);
+    ORT_RETURN_IF(node_arg == nullptr || node_arg->Shape() == nullptr,
+                  "No initialized tensor named '", name, "' in this session.");
+    MLDataType arg_type = utils::GetMLDataType(*node_arg);
+    ORT_RETURN_IF(arg_type == nullptr || !arg_type->IsTensorType() ||
+                      static_cast<const TensorTypeBase*>(arg_type)->GetElementType() != new_tensor.DataType() ||
+                      utils::GetTensorShapeFromTensorShapeProto(*node_arg->Shape()) != new_tensor.Shape() ||
+                      per_value.location.Type() != new_tensor.Location().device.Type(),
+                  "Initializer '", name,
+                  "' can only be refreshed with a tensor of identical type, shape and device.");
+    initialized_tensors_[ort_value_index] = new_value;
+  }
+
+  auto const_it = constant_initialized_tensors_.find(ort_value_index);
+  if (!was_released_after_prepack && const_it == constant_initialized_tensors_.end()) {
+    // non-constant initializers are never pre-packed, so swapping the value suffices
+    return Status::OK();
+  }
+  constant_initialized_tensors_[ort_value_index] = new_value;
+
+  // Rebuild the kernels consuming this weight and re-run their PrePack so no kernel keeps a
+  // packed copy of the old values. Mirrors the non-shared path of
+  // PrepackConstantInitializedTensors for the affected nodes only.
+  bool refreshed_weight_repacked = false;
+  for (const Node* node : graph_.GetConsumerNodes(name)) {
+    if (node->Index() >= session_kernels_.size() || session_kernels_[node->Index()] == nullptr) {
+      continue;
+    }
+
+    // control-flow kernels hold subgraph execution info that would be lost on re-creation and
+    // don't pre-pack weights; their subgraphs see the refreshed value through this session state
+    if (!node->GetAttributeNameToSubgraphMap().empty()) {
+      continue;
+    }
+
+    const KernelCreateInfo& kci = GetNodeKernelCreateInfo(node->Index());
+    const IExecutionProvider& exec_provider = *execution_providers_.Get(node->GetExecutionProviderType());
+    ORT_RETURN_IF_ERROR(kernel_registry_manager.CreateKernel(*node, exec_provider, *this, kci,
+                                                             session_kernels_[node->Index()]));
+
+    auto* kernel = GetMutableKernel(node->Index());
+    int input_idx = 0;
+    for (auto& input_def : node->InputDefs()) {
+      if (input_def->Exists()) {
+        int input_value_idx = -1;
+        if (ort_value_name_idx_map_.GetIdx(input_def->Name(), input_value_idx).IsOK()) {
+          auto constant_it = constant_initialized_tensors_.find(input_value_idx);
+          if (constant_it != constant_initialized_tensors_.end() && constant_it->second.IsTensor()) {
+            bool is_packed = false;
+            AllocatorPtr session_cpu_alloc =
+                GetAllocator(kernel->Info().GetDevice(OrtMemType::OrtMemTypeDefault));
+            // a null PrePackedWeights container selects the non-sharing contract: the kernel
+            // keeps its packed copy instead of moving it out for a caller to hand back via
+            // UseSharedPrePackedBuffers
+            ORT_RETURN_IF_ERROR(kernel->PrePack(constant_it->second.Get<Tensor>(), input_idx,
+                                                session_cpu_alloc, is_packed,
+                                                /*prepacked_weights*/ nullptr));
+            if (is_packed && input_value_idx == ort_value_index) {
+              refreshed_weight_repacked = true;
+            }
+          }
+        }
+      }
+      ++input_idx;
+    }
+  }
+
+  if (was_released_after_prepack && refreshed_weight_repacked) {
+    // restore the memory steady state: a rebuilt kernel owns a packed copy again, so the
+    // unpacked weight isn't needed. If no consumer re-packed (it shouldn't happen when the
+    // weight was released after prepacking before), keep the tensor so the next Run still has
+    // a source to read.
+    initialized_tensors_.erase(ort_value_index);
+    constant_initialized_tensors_.erase(ort_value_index);
+  }
+
+  return Status::OK();
+}
+
+Status SessionState::FinalizeSubgraphSessionState(Node& node, const std::string& attr_name,
+                                                  SessionState& subgraph_session_state,
+                                                  const std::basic_string<PATH_CHAR_TYPE>& graph_location,
+                                                  const KernelRegistryManager& kernel_registry_manager,
+                                                  const SessionOptions& subgraph_session_options,
+                                                  bool remove_initializers,
+                                                  bool save_prepacked_initializers,
+                                                  InlinedHashMap<std::string, size_t>& constant_initializers_use_count) {
+  // We need to create graph info for the subgraphs because information accumulated there
+  // is used in OuterScopeNodeArgLocationAccumulator()
+  subgraph_session_state.CreateGraphInfo(save_prepacked_initializers);
+
+  InlinedHashMap<OrtValueName, OrtDevice> subgraph_outer_scope_node_arg_to_location_map;
+  ORT_RETURN_IF_ERROR(OuterScopeNodeArgLocationAccumulator(*p_seq_exec_plan_, GetOrtValueNameIdxMap(),
+                                                           node,
+                                                           subgraph_session_state.GetGraphViewer(),
+                                                           subgraph_outer_scope_node_arg_to_location_map));
+
+  ORT_RETURN_IF_ERROR(subgraph_session_state.FinalizeSessionStateImpl(
+      graph_location, kernel_registry_manager, &node, subgraph_session_options, remove_initializers,
+      save_prepacked_initializers,
+      constant_initializers_use_count, subgraph_outer_scope_node_arg_to_location_map, true));
+
+  // setup all the info for handling the feeds and fetches used in subgraph execution
+  auto* p_op_kernel = GetMutableKernel(node.Index());
+  ORT_ENFORCE(p_op_kernel);
+
+  // Downcast is safe, since only control flow nodes have subgraphs
+  // (node.GetAttributeNameToMutableSubgraphMap() is non-empty)
+  auto& control_flow_kernel = static_cast<controlflow::IControlFlowKernel&>(*p_op_kernel);
+  return control_flow_kernel.SetupSubgraphExecutionInfo(*this, attr_name, subgraph_session_state);
+}
+
+Status SessionState::EnsureSubgraphSessionStatesFinalized(NodeIndex index) const {
+  if (num_deferred_subgraphs_.load(std::memory_order_acquire) == 0) {
+    return Status::OK();
+  }
+
+  std::lock_guard<std::mutex> lock(deferred_subgraph_mutex_);
+  auto it = deferred_subgraph_finalizes_.find(index);
+  if (it == deferred_subgraph_finalizes_.end()) {
+    return Status::OK();
+  }
+
+  // Finalization mutates session state that is otherwise immutable after Initialize(), which is
+  // why all of it happens under the mutex before the node executes for the first time.
+  auto& self = *const_cast<SessionState*>(this);
+  Node& node = *self.graph_.GetNode(index);
+
+  for (auto& deferred : it->second) {
+    SessionState* subgraph_session_state =
+        self.GetMutableSubgraphSessionState(index, deferred.attr_name);
+    ORT_ENFORCE(subgraph_session_state != nullptr,
+                "Missing session state for deferred subgraph. Node:'", node.Name(),
+                "' Index:", index, " Attribute:", deferred.attr_name);
+
+    ORT_RETURN_IF_ERROR(self.FinalizeSubgraphSessionState(
+        node, deferred.attr_name, *subgraph_session_state, deferred.graph_location,
+        *deferred.kernel_registry_manager, deferred.session_options, deferred.remove_initializers,
+        deferred.save_prepacked_initializers, self.deferred_constant_initializers_use_count_));
+  }
+
+  num_deferred_subgraphs_.fetch_sub(it->second.size(), std::memory_order_release);
+  deferred_subgraph_finalizes_.erase(it);
+  return Status::OK();
+}
+
 #ifdef ORT_ENABLE_STREAM
 static void BindToDeviceStream(const SequentialExecutionPlan& execution_plan,
                                DeviceStreamCollection& device_stream_map,
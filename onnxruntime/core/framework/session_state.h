@@ -35,7 +35,10 @@
 #include "core/framework/ort_value_name_idx_map.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/onnx_protobuf.h"
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <thread>
 #include "core/platform/path_lib.h"
 #include "core/platform/threadpool.h"
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
@@ -57,6 +60,7 @@ class ExecutionProviders;
 class KernelDef;
 class OpKernel;
 class NodeIndexInfo;
+class SharedInitializerPool;
 struct SequentialExecutionPlan;
 struct MemoryPatternGroup;
 class DeviceStreamCollection;
@@ -238,8 +242,22 @@ class SessionState {
   Status UpdateMemoryPatternGroupCache(gsl::span<const OrtValue> tensor_inputs,
                                        MemoryPatternGroup mem_patterns) const;
 
+  /**
+  Generate and cache the memory pattern for representative input shapes without executing the
+  model, reporting the planned peak size per memory location so callers can grow allocators to
+  their steady state ahead of traffic. The inputs only need valid shapes; their data is never
+  read. No-op when memory patterns are disabled. Used by InferenceSession::Warmup.
+  */
+  Status PrimeMemoryPatterns(gsl::span<const OrtValue> tensor_inputs,
+                             gsl::span<const int> feed_mlvalue_idxs,
+                             InlinedHashMap<OrtDevice, size_t>& planned_peak_sizes);
+
   bool GetUseDeterministicCompute() const { return sess_options_.use_deterministic_compute; }
 
+  // Bucket size for shape-bucketed memory patterns (see
+  // session.memory_pattern_shape_bucket_size). <= 1 means exact-shape patterns only.
+  int GetMemoryPatternShapeBucketSize() const noexcept { return memory_pattern_shape_bucket_size_; }
+
   /**
   Get enable memory pattern flag
   */
@@ -292,9 +310,86 @@ class SessionState {
   /// Return SessionState for the given Node index and attribute name if found.
   const SessionState* GetSubgraphSessionState(NodeIndex index, const std::string& attribute_name) const;
 
+  /**
+  Replace the contents of an initialized tensor after the session has been finalized, leaving
+  the execution plan, partitioning and memory patterns untouched. The new value must be a
+  tensor with the same type, shape and device type as the existing one. Kernels of consumer
+  nodes in the main graph are re-created and re-prepacked so packed copies of the old weight
+  are not used. Initializers consumed from subgraphs via outer scope are not refreshed.
+  Not safe to call concurrently with Run().
+  */
+  Status RefreshInitializedTensor(const std::string& name, const OrtValue& new_value,
+                                  const KernelRegistryManager& kernel_registry_manager);
+
+  /// Finalize any subgraph session states of the given node whose construction was deferred by
+  /// session.lazy_subgraph_session_state. No-op (after one atomic load) when nothing is pending,
+  /// so it is safe to call on the hot path before every kernel launch.
+  Status EnsureSubgraphSessionStatesFinalized(NodeIndex index) const;
+
   concurrency::ThreadPool* GetThreadPool() const noexcept { return thread_pool_; }
   concurrency::ThreadPool* GetInterOpThreadPool() const noexcept { return inter_op_thread_pool_; }
 
+  // Adaptive per-node parallelism (see session.adaptive_intra_op_threshold_us): nodes whose
+  // measured execution time stays under the threshold run single threaded, since for them the
+  // parallel-For synchronization overhead exceeds the work.
+  bool AdaptiveIntraOpParallelismEnabled() const noexcept {
+    return adaptive_intra_op_threshold_us_ > 0 && node_duration_ema_us_ != nullptr;
+  }
+
+  // Returns the intra-op pool the node's kernel should use, or nullptr to run single threaded.
+  concurrency::ThreadPool* GetThreadPoolForNode(NodeIndex node_index) const noexcept;
+
+  // Feeds the per-node duration estimate (exponential moving average, microseconds) and the
+  // per-node duration histograms when enabled.
+  void RecordNodeDuration(NodeIndex node_index, uint64_t duration_us) const noexcept;
+
+  // True when per-node execution times need to be measured at all (for the adaptive
+  // parallelism EMA and/or the duration histograms).
+  bool NodeDurationMeasurementEnabled() const noexcept {
+    return AdaptiveIntraOpParallelismEnabled() || node_duration_histograms_ != nullptr;
+  }
+
+  // Always-on per-node duration histograms (see session.collect_node_duration_histograms):
+  // bucket b counts executions whose duration in microseconds had bit width b, i.e. bucket 0
+  // is sub-microsecond, bucket b covers [2^(b-1), 2^b) microseconds. Cheap enough to leave
+  // enabled in production; read at any time, e.g. between Runs, to localize latency
+  // regressions to nodes without a profiler.
+  static constexpr size_t kNodeDurationHistogramBuckets = 32;
+  bool NodeDurationHistogramsEnabled() const noexcept { return node_duration_histograms_ != nullptr; }
+
+  // Copies the bucket counts for node_index into 'buckets'. Returns false when histogram
+  // collection is disabled or node_index is out of range.
+  bool GetNodeDurationHistogram(NodeIndex node_index,
+                                std::array<uint64_t, kNodeDurationHistogramBuckets>& buckets) const;
+
+  /**
+  Acquire/release a reusable OrtValue buffer for an ExecutionFrame's value table. The buffers
+  retain their capacity across Runs so concurrent requests stop re-allocating (and contending
+  in malloc for) a table proportional to the graph size on every Run. Released buffers are
+  cleared (destroying any remaining values) before pooling.
+  */
+  InlinedVector<OrtValue> AcquireOrtValueBuffer() const;
+  void ReleaseOrtValueBuffer(InlinedVector<OrtValue>&& buffer) const;
+
+  /**
+  Returns the session's secondary (file-backed) CPU allocator, created on first use. Values the
+  planner marked with use_secondary_allocator are served from it so their cold pages can be
+  reclaimed. See session.offload_min_def_use_gap_nodes.
+  */
+  AllocatorPtr GetSecondaryCpuAllocator() const;
+
+  /**
+  Returns the calling thread's reusable scratch allocator fronting 'backing', creating it on
+  first use. nullptr when session.reusable_scratch_buffer_max_mb is unset or 'backing' is not a
+  CPU allocator. Used by OpKernelContextInternal::GetTempSpaceAllocator.
+  */
+  AllocatorPtr GetThreadScratchAllocator(const AllocatorPtr& backing) const;
+
+  // Set the environment-owned pool used to deduplicate byte-identical constant initializers
+  // across sessions. Must be called before FinalizeSessionState. The pool must outlive this
+  // session state. nullptr (default) disables sharing.
+  void SetSharedInitializerPool(SharedInitializerPool* pool) noexcept { shared_initializer_pool_ = pool; }
+
   const FuncManager& GetFuncMgr() const noexcept { return fused_funcs_mgr_; }
   FuncManager& GetMutableFuncMgr() noexcept { return fused_funcs_mgr_; }
 
@@ -423,6 +518,30 @@ class SessionState {
   Status PopulateKernelCreateInfo(const KernelRegistryManager& kernel_registry_manager,
                                   bool saving_ort_format);
 
+  // Finalizes one subgraph session state and wires up the owning control-flow kernel's
+  // subgraph execution info. Used both for the eager path during FinalizeSessionStateImpl and
+  // for deferred construction on first node execution.
+  Status FinalizeSubgraphSessionState(Node& node, const std::string& attr_name,
+                                      SessionState& subgraph_session_state,
+                                      const std::basic_string<PATH_CHAR_TYPE>& graph_location,
+                                      const KernelRegistryManager& kernel_registry_manager,
+                                      const SessionOptions& subgraph_session_options,
+                                      bool remove_initializers,
+                                      bool save_prepacked_initializers,
+                                      InlinedHashMap<std::string, size_t>& constant_initializers_use_count);
+
+  // Everything needed to run FinalizeSubgraphSessionState later, for subgraphs whose
+  // construction is deferred until the owning node first executes
+  // (session.lazy_subgraph_session_state).
+  struct DeferredSubgraphFinalize {
+    std::string attr_name;
+    std::basic_string<PATH_CHAR_TYPE> graph_location;
+    const KernelRegistryManager* kernel_registry_manager;
+    SessionOptions session_options;
+    bool remove_initializers;
+    bool save_prepacked_initializers;
+  };
+
   Status FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
                                   const KernelRegistryManager& kernel_registry_manager,
                                   _In_opt_ const Node* parent_node,
@@ -433,13 +552,11 @@ class SessionState {
                                   const InlinedHashMap<OrtValueName, OrtDevice>& outer_scope_node_arg_to_location_map = {},
                                   bool graph_info_already_created = false);
 
-#ifdef ENABLE_TRAINING
   Status GeneratePatternGroupCache(
       gsl::span<const OrtValue> inputs,
       gsl::span<const int> feed_mlvalue_idxs,
       MemoryPatternGroup& output,
       InlinedHashMap<int, TensorShape>& inferred_shapes) const;
-#endif
 
   // KernelCreateInfo for each node so we do kernel lookup once
   KernelCreateInfoMap kernel_create_info_map_;
@@ -527,6 +644,31 @@ class SessionState {
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
 
+  // see GetMemoryPatternShapeBucketSize
+  int memory_pattern_shape_bucket_size_ = 0;
+
+  // pooled ExecutionFrame value tables; see Acquire/ReleaseOrtValueBuffer
+  mutable std::mutex ort_value_buffer_pool_mutex_;
+  mutable InlinedVector<InlinedVector<OrtValue>> ort_value_buffer_pool_;
+
+  // lazily created file-backed CPU allocator for offloaded activations
+  mutable std::mutex secondary_cpu_allocator_mutex_;
+  mutable AllocatorPtr secondary_cpu_allocator_;
+
+  // per-node duration measurement state, sized num_nodes_for_duration_stats_ nodes: the EMA
+  // feeds adaptive per-node parallelism (entries are 0 until first measured), the log2
+  // histograms the always-on counters (kNodeDurationHistogramBuckets buckets per node)
+  int adaptive_intra_op_threshold_us_ = 0;
+  bool collect_node_duration_histograms_ = false;
+  size_t num_nodes_for_duration_stats_ = 0;
+  mutable std::unique_ptr<std::atomic<uint32_t>[]> node_duration_ema_us_;
+  mutable std::unique_ptr<std::atomic<uint64_t>[]> node_duration_histograms_;
+
+  // per-thread reusable scratch allocators for kernel workspace; 0 cap disables them
+  size_t scratch_buffer_max_bytes_ = 0;
+  mutable std::mutex scratch_allocators_mutex_;
+  mutable std::unordered_map<std::thread::id, AllocatorPtr> scratch_allocators_;
+
   // lock for the mem_patterns_
   mutable std::mutex mem_patterns_lock_;
   // cache for the generated mem_patterns. key is calculated based on input shapes.
@@ -545,6 +687,21 @@ class SessionState {
 
   SubgraphSessionStateMap subgraph_session_states_;
 
+  // Environment-owned cross-session initializer dedup pool; nullptr when disabled.
+  SharedInitializerPool* shared_initializer_pool_{nullptr};
+
+  // Pending deferred subgraph finalizations keyed by owning node index. Guarded by
+  // deferred_subgraph_mutex_; num_deferred_subgraphs_ provides the lock-free fast path.
+  mutable std::mutex deferred_subgraph_mutex_;
+  mutable std::atomic<size_t> num_deferred_subgraphs_{0};
+  mutable InlinedHashMap<NodeIndex, std::vector<DeferredSubgraphFinalize>> deferred_subgraph_finalizes_;
+  // One use-count map shared by every deferred finalize (the caller's map is a stack local, so
+  // it is copied once at defer time). Sharing it keeps the release bookkeeping correct:
+  // decrements made by one lazily-finalized subgraph must be visible to the rest, or
+  // initializers shared across subgraphs never reach zero and are never released.
+  // Guarded by deferred_subgraph_mutex_.
+  mutable InlinedHashMap<std::string, size_t> deferred_constant_initializers_use_count_;
+
   // either threadpool could be nullptr
   concurrency::ThreadPool* const thread_pool_{};
   concurrency::ThreadPool* const inter_op_thread_pool_{};
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <cstdlib>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -27,7 +29,9 @@
 #include "core/framework/bfc_arena.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/framework/mem_buffer.h"
+#include "core/framework/shared_initializer_pool.h"
 #include "core/framework/tensor_allocator.h"
+#include "core/platform/threadpool.h"
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 #include "core/framework/memory_info.h"
 #endif
@@ -280,7 +284,9 @@ common::Status SaveInitializedTensors(
     const SessionOptions& session_options,
     const MemoryProfileFunction& memory_profile_func,
     std::unordered_map<std::string, std::unique_ptr<Tensor>>& buffered_tensors,
-    PrepackedWeightsForGraph& prepacked_for_graph) {
+    PrepackedWeightsForGraph& prepacked_for_graph,
+    concurrency::ThreadPool* init_thread_pool,
+    SharedInitializerPool* shared_initializer_pool) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -334,12 +340,24 @@ common::Status SaveInitializedTensors(
   // NB1: vector with init allocation order may contain a subset of all tensors (or none at all)
   // NB2: only skip tracing and planning memory when data is external (i.e mmap) and on CPU.
   //    when data is external and on GPU, need to copy first to cpu memory, then to gpu memory.
+  // Initializers participating in cross-session dedup are loaded into individually owned
+  // allocations instead of the shared arena slab, so the canonical copy can outlive any one
+  // session. Only raw_data initializers staying on CPU qualify: their source bytes are
+  // available up front for the content-hash lookup.
+  auto is_dedup_candidate = [shared_initializer_pool, &exec_plan, &graph](
+                                int ort_value_index, const ONNX_NAMESPACE::TensorProto& tensor_proto) {
+    return shared_initializer_pool != nullptr && tensor_proto.has_raw_data() &&
+           exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU &&
+           graph.IsConstantInitializer(tensor_proto.name(), /* check_outer_scope */ false);
+  };
+
   auto initialized_tensors_to_allocate = id_to_initialized_tensor;
   for (int ort_value_index : initializer_allocation_order) {
     const auto entry = initialized_tensors_to_allocate.find(ort_value_index);
     ORT_ENFORCE(entry != initialized_tensors_to_allocate.end(),
                 "OrtValue index: ", ort_value_index, " from initializer_allocation_order not found among initialized tensors");
-    if (!(utils::HasExternalData(*entry->second) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU)) {
+    if (!(utils::HasExternalData(*entry->second) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU) &&
+        !is_dedup_candidate(ort_value_index, *entry->second)) {
       // can not trace string tensor
       ORT_ENFORCE(entry->second->data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING, "Can not trace string tensor");
       ORT_RETURN_IF_ERROR(planner.Trace(entry->first, entry->second));
@@ -356,6 +374,15 @@ common::Status SaveInitializedTensors(
       // do not trace string tensor
       continue;
     }
+    // see NB2 above: external data destined for CPU aliases the mmap'd file for the session's
+    // lifetime (DeserializeTensorProto never touches the pre-allocated buffer), so tracing it
+    // here would only grow the weights arena with space that is never used.
+    if (utils::HasExternalData(*entry.second) && exec_plan.GetLocation(entry.first).Type() == OrtDevice::CPU) {
+      continue;
+    }
+    if (is_dedup_candidate(entry.first, *entry.second)) {
+      continue;
+    }
     ORT_RETURN_IF_ERROR(planner.Trace(entry.first, entry.second));
   }
 
@@ -376,9 +403,32 @@ common::Status SaveInitializedTensors(
 
   OrtCallback deleter{nullptr, nullptr};
 
-  // 3. create weight tensors based on weights buffer
+  // 3. create weight tensors based on weights buffer.
+  // Deserialization of individual initializers is independent work, so when the session is
+  // configured for parallel initialization the expensive DeserializeTensorProto calls are fanned
+  // out across the thread pool. Buffer planning (above) and AddInitializedTensor (below) stay
+  // single threaded: the former hands out slices of one preallocated block in order, the latter
+  // writes into session state.
+  struct PendingInitializer {
+    int ort_value_index;
+    const std::string* name;
+    const ONNX_NAMESPACE::TensorProto* tensor_proto{nullptr};  // nullptr if ort_value is already populated
+    std::optional<MemBuffer> m;
+    AllocatorPtr alloc;
+    Tensor* p_tensor{nullptr};
+    OrtValue ort_value;
+    Status status;
+    bool offer_to_shared_pool{false};
+  };
+
+  const bool use_device_allocator_for_initializers =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+
+  std::vector<PendingInitializer> pending;
+  pending.reserve(id_to_initialized_tensor.size());
+  size_t num_to_deserialize = 0;
+
   for (const auto& entry : id_to_initialized_tensor) {
-    // We check for cancellation for every initializer since mapping from disk can be costly
     if (session_options.IsLoadCancellationFlagSet()) {
       return ORT_MAKE_STATUS(ONNXRUNTIME, MODEL_LOAD_CANCELED,
                              "Saving session state weights is canceled due to user request.");
@@ -392,59 +442,173 @@ common::Status SaveInitializedTensors(
       continue;
     }
 
-    OrtValue ort_value;
+    PendingInitializer item;
+    item.ort_value_index = ort_value_index;
+    item.name = &entry.second->name();
 
     if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
-      ort_value = *(session_options.initializers_to_share_map.at(name));
+      item.ort_value = *(session_options.initializers_to_share_map.at(name));
       LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
-
-    } else if (graph.GetOrtValueInitializer(name, ort_value)) {
+    } else if (graph.GetOrtValueInitializer(name, item.ort_value)) {
       // populated OrtValue from the Graph instance
+    } else if (is_dedup_candidate(ort_value_index, *entry.second) &&
+               shared_initializer_pool->Lookup(
+                   entry.second->raw_data().data(), entry.second->raw_data().size(),
+                   DataTypeImpl::TensorTypeFromONNXEnum(entry.second->data_type())->GetElementType(),
+                   utils::GetTensorShapeFromTensorProto(*entry.second), item.ort_value)) {
+      // byte-identical weight already loaded by another session; alias its buffer and skip
+      // deserialization entirely
+      LOGS(logger, INFO) << "Sharing initializer (" << name << ") with another session.";
     } else {
-      const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
+      item.tensor_proto = entry.second;
+      item.offer_to_shared_pool = is_dedup_candidate(ort_value_index, *entry.second);
 
-      std::optional<MemBuffer> m;
-      AllocatorPtr alloc;
       // TODO: if the tensor need be copied, does it have enough room?
-      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
-      bool use_device_allocator_for_initializers =
-          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, item.m, item.alloc));
 
-      Tensor* p_tensor = nullptr;
       auto buffered_tensors_iter = buffered_tensors.find(name);
       if (buffered_tensors_iter != buffered_tensors.end()) {
-        p_tensor = buffered_tensors_iter->second.get();
+        item.p_tensor = buffered_tensors_iter->second.get();
+      }
+
+      ++num_to_deserialize;
+    }
+
+    pending.push_back(std::move(item));
+  }
+
+  // Deserialize in execution-plan first-use order: the weights a cold start needs first are
+  // read (and page in) first, so time-to-first-inference isn't gated on tail weights.
+  // id_to_initialized_tensor iterates in hash order otherwise. AddInitializedTensor is keyed
+  // by value index, so the changed processing order is semantically neutral.
+  {
+    InlinedHashMap<int, size_t> first_use_position;
+    first_use_position.reserve(pending.size());
+    size_t position = 0;
+    for (NodeIndex node_index : graph.GetNodesInTopologicalOrder()) {
+      const Node* node = graph.GetNode(node_index);
+      auto record_first_use = [&](const NodeArg* input_def) {
+        if (input_def->Exists()) {
+          int value_idx = -1;
+          if (ort_value_name_idx_map.GetIdx(input_def->Name(), value_idx).IsOK()) {
+            first_use_position.emplace(value_idx, position);  // emplace keeps the first use
+          }
+        }
+        ++position;
+      };
+      for (const auto* input_def : node->InputDefs()) {
+        record_first_use(input_def);
+      }
+      for (const auto* input_def : node->ImplicitInputDefs()) {
+        record_first_use(input_def);
       }
+    }
+
+    const size_t never_used = std::numeric_limits<size_t>::max();
+    auto use_position = [&](const PendingInitializer& item) {
+      auto it = first_use_position.find(item.ort_value_index);
+      return it != first_use_position.end() ? it->second : never_used;
+    };
+    std::stable_sort(pending.begin(), pending.end(),
+                     [&](const PendingInitializer& a, const PendingInitializer& b) {
+                       return use_position(a) < use_position(b);
+                     });
+  }
+
+  auto deserialize_item = [&](PendingInitializer& item) {
+    if (session_options.IsLoadCancellationFlagSet()) {
+      item.status = ORT_MAKE_STATUS(ONNXRUNTIME, MODEL_LOAD_CANCELED,
+                                    "Saving session state weights is canceled due to user request.");
+      return;
+    }
+
+    // a throw escaping a pool worker would terminate the process, so fold exceptions into
+    // the per-item status the same way Initialize() does on the calling thread
+    ORT_TRY {
+      item.status = DeserializeTensorProto(env, graph_loc, *item.tensor_proto,
+                                           (item.m.has_value()) ? &*item.m : nullptr, item.alloc,
+                                           default_cpu_alloc, item.ort_value, data_transfer_mgr,
+                                           external_data_loader_mgr, prepacked_for_graph,
+                                           use_device_allocator_for_initializers, item.p_tensor);
+    }
+    ORT_CATCH(const std::exception& e) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        item.status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exception deserializing initializer: ", e.what());
+      });
+    }
+  };
+
+  int parallel_degree = 0;
+  {
+    const std::string degree_str =
+        session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsParallelInitializeDegree, "0");
+    parallel_degree = std::atoi(degree_str.c_str());
+  }
 
-      Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, (m.has_value()) ? &*m : nullptr, alloc,
-                                         default_cpu_alloc, ort_value, data_transfer_mgr, external_data_loader_mgr,
-                                         prepacked_for_graph,
-                                         use_device_allocator_for_initializers, p_tensor);
-      if (!st.IsOK()) {
+  const auto num_shards = static_cast<std::ptrdiff_t>(
+      std::min<size_t>(static_cast<size_t>(std::max(parallel_degree, 0)), num_to_deserialize));
+  if (init_thread_pool != nullptr && num_shards > 1) {
+    // External-data initializers are kept on the calling thread: their deserialization may insert
+    // pre-packed blobs into the shared PrepackedWeightsForGraph container, which is not
+    // synchronized.
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        init_thread_pool, num_shards,
+        [&pending, &deserialize_item, num_shards](std::ptrdiff_t shard) {
+          for (size_t i = static_cast<size_t>(shard); i < pending.size(); i += static_cast<size_t>(num_shards)) {
+            if (pending[i].tensor_proto != nullptr && !utils::HasExternalData(*pending[i].tensor_proto)) {
+              deserialize_item(pending[i]);
+            }
+          }
+        });
+    for (auto& item : pending) {
+      if (item.tensor_proto != nullptr && utils::HasExternalData(*item.tensor_proto)) {
+        deserialize_item(item);
+      }
+    }
+  } else {
+    for (auto& item : pending) {
+      if (item.tensor_proto != nullptr) {
+        deserialize_item(item);
+      }
+    }
+  }
+
+  for (auto& item : pending) {
+    const std::string& name = *item.name;
+
+    if (item.tensor_proto != nullptr) {
+      if (!item.status.IsOK()) {
         std::ostringstream oss;
-        oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
-        return Status(st.Category(), st.Code(), oss.str());
+        oss << "Deserialize tensor " << name << " failed." << item.status.ErrorMessage();
+        return Status(item.status.Category(), item.status.Code(), oss.str());
       }
 
-      if (p_tensor != nullptr) {
+      if (item.p_tensor != nullptr) {
         // p_tensor was wrapped in a deleter by DeserializeTensorProto so we can simply release it here.
+        auto buffered_tensors_iter = buffered_tensors.find(name);
         ORT_IGNORE_RETURN_VALUE(buffered_tensors_iter->second.release());
         buffered_tensors.erase(buffered_tensors_iter);
       }
+
+      if (item.offer_to_shared_pool) {
+        // either becomes the canonical cross-session copy or is replaced by one that raced us
+        // here, in which case this session's buffer is released with the pending list
+        item.ort_value = shared_initializer_pool->GetOrAdd(item.ort_value);
+      }
     }
 
     // 'name' is a reference to a string within the TensorProto that save_tensor_func may free
     // so we need to output this message prior to calling save_tensor_func
-    VLOGS(logger, 1) << "Adding weight with name : " << name << " with index: " << ort_value_index;
+    VLOGS(logger, 1) << "Adding weight with name : " << name << " with index: " << item.ort_value_index;
 
     // any outer scope value is shadowed by a local value and can't override it.
     // due to that check_outer_scope is false
     const bool constant = graph.IsConstantInitializer(name, /* check_outer_scope */ false);
 #if !defined(DISABLE_SPARSE_TENSORS)
     const bool sparse = graph.GetGraph().IsSparseInitializer(name);
-    ORT_RETURN_IF_ERROR(save_tensor_func(name, ort_value_index, ort_value, deleter, constant, sparse));
+    ORT_RETURN_IF_ERROR(save_tensor_func(name, item.ort_value_index, item.ort_value, deleter, constant, sparse));
 #else
-    ORT_RETURN_IF_ERROR(save_tensor_func(name, ort_value_index, ort_value, deleter, constant, false));
+    ORT_RETURN_IF_ERROR(save_tensor_func(name, item.ort_value_index, item.ort_value, deleter, constant, false));
 #endif
   }
 
@@ -26,6 +26,12 @@ class OrtValueNameIdxMap;
 class DataTransferManager;
 class ExternalDataLoaderManager;
 class NodeArg;
+class SharedInitializerPool;
+
+namespace concurrency {
+class ThreadPool;
+}
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 class MemoryInfo;
 #endif
@@ -52,7 +58,9 @@ common::Status SaveInitializedTensors(
     const SessionOptions& session_options,
     const MemoryProfileFunction& memory_profile_func,
     std::unordered_map<std::string, std::unique_ptr<Tensor>>& buffered_tensors,
-    PrepackedWeightsForGraph& prepacked_for_graph);
+    PrepackedWeightsForGraph& prepacked_for_graph,
+    concurrency::ThreadPool* init_thread_pool = nullptr,
+    SharedInitializerPool* shared_initializer_pool = nullptr);
 
 common::Status AllocateTensor(
     const onnxruntime::MemBuffer* m,
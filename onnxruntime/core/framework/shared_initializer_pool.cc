@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/shared_initializer_pool.h"
+
+#include <cstring>
+
+#include "core/framework/murmurhash3.h"
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+namespace {
+uint64_t HashContent(const void* data, size_t size_in_bytes) {
+  uint32_t hash[4] = {0, 0, 0, 0};
+  MurmurHash3::x86_128(data, size_in_bytes, 0, &hash);
+  return (static_cast<uint64_t>(hash[0]) << 32) | hash[1];
+}
+}  // namespace
+
+bool SharedInitializerPool::Lookup(const void* data, size_t size_in_bytes,
+                                   const DataTypeImpl* element_type, const TensorShape& shape,
+                                   OrtValue& out) const {
+  if (data == nullptr || size_in_bytes == 0) {
+    return false;
+  }
+
+  const ContentKey key{HashContent(data, size_in_bytes), size_in_bytes};
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return false;
+  }
+
+  const Tensor& existing = it->second.Get<Tensor>();
+  if (existing.DataType() != element_type ||
+      existing.Shape() != shape ||
+      std::memcmp(existing.DataRaw(), data, size_in_bytes) != 0) {
+    return false;
+  }
+
+  out = it->second;
+  return true;
+}
+
+OrtValue SharedInitializerPool::GetOrAdd(const OrtValue& value) {
+  if (!value.IsTensor()) {
+    return value;
+  }
+
+  const Tensor& tensor = value.Get<Tensor>();
+  if (tensor.Location().device.Type() != OrtDevice::CPU ||
+      tensor.IsDataTypeString() ||
+      tensor.DataRaw() == nullptr ||
+      tensor.SizeInBytes() == 0) {
+    return value;
+  }
+
+  const ContentKey key{HashContent(tensor.DataRaw(), tensor.SizeInBytes()), tensor.SizeInBytes()};
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    // Guard against hash collisions with a full byte compare before aliasing the entry.
+    const Tensor& existing = it->second.Get<Tensor>();
+    if (existing.DataType() == tensor.DataType() &&
+        existing.Shape() == tensor.Shape() &&
+        std::memcmp(existing.DataRaw(), tensor.DataRaw(), tensor.SizeInBytes()) == 0) {
+      return it->second;
+    }
+    return value;
+  }
+
+  entries_.emplace(key, value);
+  return value;
+}
+
+}  // namespace onnxruntime
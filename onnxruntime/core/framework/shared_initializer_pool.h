@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "core/common/common.h"
+#include "core/framework/ort_value.h"
+#include "core/framework/tensor_shape.h"
+
+namespace onnxruntime {
+
+class DataTypeImpl;
+
+// Content-hash based pool of constant initializer tensors, shared by all sessions created from
+// one Environment (see session.cross_session_initializer_sharing). When several sessions load
+// models containing byte-identical weights (e.g. fine-tuned variants of one base model), the
+// pool maps them to a single physical buffer: the first session's copy becomes canonical and
+// later sessions drop theirs in favor of it.
+//
+// Entries are held for the lifetime of the Environment so that sessions created later can still
+// share them; only CPU, non-string tensors participate.
+class SharedInitializerPool {
+ public:
+  SharedInitializerPool() = default;
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SharedInitializerPool);
+
+  // Returns the canonical OrtValue for the tensor held by 'value'. If an entry with identical
+  // content exists it is returned (and 'value''s buffer can be released by the caller dropping
+  // its reference); otherwise 'value' becomes the canonical entry. Values that are not CPU
+  // tensors, hold strings, or have no data are returned unchanged.
+  OrtValue GetOrAdd(const OrtValue& value);
+
+  // Looks up an entry with the given element type and shape whose content is byte-identical to
+  // [data, data + size_in_bytes). Returns true and sets 'out' on a (memcmp-verified) hit. Used
+  // to skip deserialization entirely when the source bytes are available up front (raw_data
+  // initializers). The type/shape check matters: identical bytes can represent tensors with
+  // different dimensions, and the aliased tensor's shape is what kernels will see.
+  bool Lookup(const void* data, size_t size_in_bytes, const DataTypeImpl* element_type,
+              const TensorShape& shape, OrtValue& out) const;
+
+  size_t Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+ private:
+  struct ContentKey {
+    uint64_t hash;
+    size_t size_in_bytes;
+
+    bool operator==(const ContentKey& other) const {
+      return hash == other.hash && size_in_bytes == other.size_in_bytes;
+    }
+  };
+
+  struct ContentKeyHasher {
+    size_t operator()(const ContentKey& key) const {
+      return static_cast<size_t>(key.hash) ^ key.size_in_bytes;
+    }
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<ContentKey, OrtValue, ContentKeyHasher> entries_;
+};
+
+}  // namespace onnxruntime
@@ -270,6 +270,9 @@ void ScheduleDownstream(StreamExecutionContext& ctx, size_t trigger, bool single
       // increase the task count before schedule down-stream
       ctx.AddTask();
       concurrency::ThreadPool::Schedule(tp, [&ctx, downstream, &terminate_flag, &session_scope]() {
+        // bracket the task so intra-op loops it spawns divide the workers among concurrent tasks
+        concurrency::ThreadPool::NestedRegionScope nested_region_scope(
+            ctx.GetSessionState().GetThreadPool());
         RunSince(downstream.first, ctx, session_scope, terminate_flag, downstream.second);
       });
     }
@@ -3,6 +3,7 @@
 
 #include "core/framework/tensor.h"
 
+#include <new>
 #include <utility>
 #include "core/common/safeint.h"
 #include "core/framework/data_types.h"
@@ -105,8 +106,31 @@ Tensor::Tensor(MLDataType elt_type, const TensorShape& shape, void* p_data, std:
 
 void Tensor::InitOrtValue(MLDataType elt_type, const TensorShape& shape, std::shared_ptr<IAllocator> allocator,
                           OrtValue& ort_value) {
-  auto p_tensor = std::make_unique<Tensor>(elt_type, shape, std::move(allocator));
   auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+
+  // Small-tensor fast path: co-locate the Tensor object and its payload in one allocation.
+  // The scalar/shape/predicate glue tensors that dominate some graphs otherwise cost two heap
+  // round trips (Tensor object + data) each.
+  constexpr size_t kInlineDataThreshold = 64;
+  // multiple of 64 so the payload keeps the alignment the separate-allocation path provides
+  constexpr size_t kInlineDataOffset = ((sizeof(Tensor) + 63) / 64) * 64;
+
+  const size_t len = CalculateTensorStorageSize(elt_type, shape);
+  if (len > 0 && len <= kInlineDataThreshold &&
+      elt_type != DataTypeImpl::GetType<std::string>() &&
+      allocator->Info().device.Type() == OrtDevice::CPU) {
+    void* block = allocator->Alloc(kInlineDataOffset + len);
+    void* p_data = static_cast<char*>(block) + kInlineDataOffset;
+    Tensor* p_tensor = new (block) Tensor(elt_type, shape, p_data, allocator->Info());
+    ort_value.Init(p_tensor, ml_tensor,
+                   [allocator = std::move(allocator)](void* p) {
+                     static_cast<Tensor*>(p)->~Tensor();
+                     allocator->Free(p);
+                   });
+    return;
+  }
+
+  auto p_tensor = std::make_unique<Tensor>(elt_type, shape, std::move(allocator));
   ort_value.Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
 }
 
@@ -153,6 +153,11 @@ ONNX_MS_OPERATOR_SET_SCHEMA(
               "If it's specified, it means per 'axis' quantization and input 'x_scale' and 'x_zero_point' must be 1-D "
               "tensors.",
               AttributeProto::INT, false)
+        .Attr("fuse_relu",
+              "(Optional) If nonzero, ReLU is applied to 'x' before quantizing, i.e. "
+              "y = saturate(relu(x) / y_scale + y_zero_point). Set by the optimizer when fusing a "
+              "preceding Relu node; only supported for 8-bit output types.",
+              AttributeProto::INT, static_cast<int64_t>(0))
         .Input(0, "x", "N-D full precision Input tensor to be quantized.", "T1")
         .Input(1, "y_scale",
                "Scale for doing quantization to get 'y'. It can be a scalar, which means per-tensor/layer "
@@ -3150,7 +3150,9 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
     const auto& node_name = node.Name();
 
     if (!node.Op()) {
-      {
+      // a trusted model was validated when it was produced, so the ONNX checker is skipped and
+      // only the schema binding below happens.
+      if (!options.trusted_model) {
         auto status = Status::OK();
         ORT_TRY {
           // if this is first Graph::Resolve call, we may have a NodeProto that was set on the Node so we can skip
@@ -3232,7 +3234,12 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
       }
     }
 
-    NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+    // trusted models reuse the type/shape metadata recorded when they were produced instead of
+    // re-running inference. NodeArgs missing type information surface later as kernel
+    // resolution errors, so such models must have been saved with complete metadata.
+    if (!options.trusted_model) {
+      NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+    }
 
     // Accumulate output names of the iterated Node
     for (const auto& output : node.OutputDefs()) {
@@ -372,4 +372,22 @@ const std::unordered_set<std::string>& GraphViewer::GetOuterScopeNodeArgNames()
 }
 #endif
 
+
+gsl::span<const NodeIndex> GraphViewer::GetNodesByOpType(const std::string& op_type) const {
+  std::call_once(op_type_index_once_, [this]() {
+    for (NodeIndex node_index : GetNodesInTopologicalOrder()) {
+      const Node* node = GetNode(node_index);
+      if (node != nullptr) {
+        op_type_to_nodes_[node->OpType()].push_back(node_index);
+      }
+    }
+  });
+
+  auto it = op_type_to_nodes_.find(op_type);
+  if (it == op_type_to_nodes_.end()) {
+    return {};
+  }
+  return gsl::make_span(it->second);
+}
+
 }  // namespace onnxruntime
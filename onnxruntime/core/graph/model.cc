@@ -1,7 +1,12 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "core/common/logging/logging.h"
 #include "core/flatbuffers/schema/ort.fbs.h"
 #include "core/flatbuffers/flatbuffers_utils.h"
@@ -449,6 +454,7 @@ Status Model::Load(const ModelProto& model_proto,
 
   Graph::ResolveOptions resolve_options;
   resolve_options.no_proto_sync_required = true;
+  resolve_options.trusted_model = options.trusted_model;
   ORT_RETURN_IF_ERROR(model->MainGraph().Resolve(resolve_options));
 
   return status;
@@ -493,6 +499,7 @@ Status Model::Load(ModelProto&& model_proto,
 
   Graph::ResolveOptions resolve_options;
   resolve_options.no_proto_sync_required = true;
+  resolve_options.trusted_model = options.trusted_model;
   ORT_RETURN_IF_ERROR(model->MainGraph().Resolve(resolve_options));
 
   return status;
@@ -690,6 +697,7 @@ Status Model::LoadFromBytes(int count, void* p_bytes, const PathString& model_pa
 
   Graph::ResolveOptions resolve_options;
   resolve_options.no_proto_sync_required = true;
+  resolve_options.trusted_model = options.trusted_model;
   ORT_RETURN_IF_ERROR(p_model->MainGraph().Resolve(resolve_options));
 
   return Status::OK();
@@ -699,6 +707,145 @@ using ::google::protobuf::io::CodedInputStream;
 using ::google::protobuf::io::FileInputStream;
 using ::google::protobuf::io::ZeroCopyInputStream;
 
+#if GOOGLE_PROTOBUF_VERSION >= 3002000
+namespace {
+
+// Models at or above this size are parsed through the read-ahead stream below so that storage
+// I/O overlaps with protobuf parsing. Small models aren't worth a worker thread.
+constexpr size_t kReadAheadThresholdBytes = 64 * 1024 * 1024;
+
+// Wraps a blocking ZeroCopyInputStream with a background reader thread and a small queue of
+// copied blocks: while protobuf parses block N on the calling thread, the worker is already
+// blocked in the inner stream reading block N+1. For multi-GB models on networked storage this
+// hides most of the read latency behind CPU-bound parsing.
+class ReadAheadInputStream final : public ZeroCopyInputStream {
+ public:
+  ReadAheadInputStream(FileInputStream& inner, size_t max_buffered_blocks = 2)
+      : inner_(inner),
+        max_buffered_blocks_(max_buffered_blocks),
+        reader_([this] { ReadLoop(); }) {
+  }
+
+  ~ReadAheadInputStream() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    space_available_.notify_all();
+    reader_.join();
+  }
+
+  bool Next(const void** data, int* size) override {
+    if (backed_up_bytes_ > 0) {
+      *data = last_block_.data() + last_block_.size() - backed_up_bytes_;
+      *size = static_cast<int>(backed_up_bytes_);
+      byte_count_ += backed_up_bytes_;
+      backed_up_bytes_ = 0;
+      return true;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    data_available_.wait(lock, [this] { return !queue_.empty() || done_; });
+    if (queue_.empty()) {
+      return false;
+    }
+
+    last_block_ = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    space_available_.notify_one();
+
+    *data = last_block_.data();
+    *size = static_cast<int>(last_block_.size());
+    byte_count_ += last_block_.size();
+    return true;
+  }
+
+  void BackUp(int count) override {
+    ORT_ENFORCE(count >= 0 && static_cast<size_t>(count) <= last_block_.size() - backed_up_bytes_,
+                "Invalid BackUp() of ", count, " bytes.");
+    backed_up_bytes_ += static_cast<size_t>(count);
+    byte_count_ -= static_cast<size_t>(count);
+  }
+
+  bool Skip(int count) override {
+    while (count > 0) {
+      const void* data = nullptr;
+      int size = 0;
+      if (!Next(&data, &size)) {
+        return false;
+      }
+      if (size > count) {
+        BackUp(size - count);
+        return true;
+      }
+      count -= size;
+    }
+    return true;
+  }
+
+  int64_t ByteCount() const override {
+    return static_cast<int64_t>(byte_count_);
+  }
+
+  // Valid once parsing has finished (the worker has hit EOF or an error by then).
+  int GetErrno() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return inner_errno_;
+  }
+
+ private:
+  void ReadLoop() {
+    for (;;) {
+      const void* data = nullptr;
+      int size = 0;
+      if (!inner_.Next(&data, &size)) {
+        break;
+      }
+      if (size == 0) {
+        continue;
+      }
+
+      std::vector<char> block(static_cast<const char*>(data),
+                              static_cast<const char*>(data) + size);
+      std::unique_lock<std::mutex> lock(mutex_);
+      space_available_.wait(lock, [this] { return queue_.size() < max_buffered_blocks_ || shutdown_; });
+      if (shutdown_) {
+        return;
+      }
+      queue_.push_back(std::move(block));
+      lock.unlock();
+      data_available_.notify_one();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    inner_errno_ = inner_.GetErrno();
+    done_ = true;
+    data_available_.notify_one();
+  }
+
+  FileInputStream& inner_;
+  const size_t max_buffered_blocks_;
+
+  std::mutex mutex_;
+  std::condition_variable data_available_;
+  std::condition_variable space_available_;
+  std::deque<std::vector<char>> queue_;
+  bool done_ = false;
+  bool shutdown_ = false;
+  int inner_errno_ = 0;
+
+  // consumer-thread-only state
+  std::vector<char> last_block_;
+  size_t backed_up_bytes_ = 0;
+  size_t byte_count_ = 0;
+
+  std::thread reader_;
+};
+
+}  // namespace
+#endif  // GOOGLE_PROTOBUF_VERSION >= 3002000
+
 Status Model::Load(int fd, ONNX_NAMESPACE::ModelProto& model_proto) {
   if (fd < 0) {
     return Status(ONNXRUNTIME, INVALID_ARGUMENT, "<p_fd> less than 0.");
@@ -712,7 +859,15 @@ Status Model::Load(int fd, ONNX_NAMESPACE::ModelProto& model_proto) {
     block_size = std::min(DEFAULT_PROTOBUF_BLOCK_SIZE, static_cast<int>(file_size));
   }
   FileInputStream input(fd, block_size);
-  const bool result = model_proto.ParseFromZeroCopyStream(&input) && input.GetErrno() == 0;
+
+  bool result = false;
+  if (st.IsOK() && file_size >= kReadAheadThresholdBytes) {
+    ReadAheadInputStream read_ahead_input(input);
+    result = model_proto.ParseFromZeroCopyStream(&read_ahead_input) && read_ahead_input.GetErrno() == 0;
+  } else {
+    result = model_proto.ParseFromZeroCopyStream(&input) && input.GetErrno() == 0;
+  }
+
   if (!result) {
     return Status(ONNXRUNTIME, INVALID_PROTOBUF, "Protobuf parsing failed.");
   }
@@ -749,6 +904,7 @@ Status Model::Load(int fd, const PathString& model_path, std::shared_ptr<Model>&
 
   Graph::ResolveOptions resolve_options;
   resolve_options.no_proto_sync_required = true;
+  resolve_options.trusted_model = options.trusted_model;
   ORT_RETURN_IF_ERROR(p_model->MainGraph().Resolve(resolve_options));
 
   return Status::OK();
@@ -41,11 +41,18 @@ struct ModelOptions {
 
   CheckLoadCancellationFn check_load_cancellation_fn;
 
+  // If true, the model is treated as pre-validated: ONNX schema checking and type/shape
+  // inference are skipped during Graph::Resolve and the type/shape metadata recorded in the
+  // model is used as-is. Only for models validated at build time and shipped read-only.
+  bool trusted_model = false;
+
   ModelOptions(bool allow_released_opsets_only, bool strict_shape_type_inference,
-               CheckLoadCancellationFn check_load_cancellation_fn)
+               CheckLoadCancellationFn check_load_cancellation_fn,
+               bool trusted_model = false)
       : allow_released_opsets_only(allow_released_opsets_only),
         strict_shape_type_inference(strict_shape_type_inference),
-        check_load_cancellation_fn(std::move(check_load_cancellation_fn)) {}
+        check_load_cancellation_fn(std::move(check_load_cancellation_fn)),
+        trusted_model(trusted_model) {}
 
   ModelOptions(bool allow_released_opsets_only, bool strict_shape_type_inference)
       : allow_released_opsets_only(allow_released_opsets_only),
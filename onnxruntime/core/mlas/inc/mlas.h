@@ -245,6 +245,59 @@ MlasGemmBatch(
     MLAS_THREADPOOL* ThreadPool
     );
 
+/**
+ * @brief  Strided batched single precision matrix/matrix multiply operation (SGEMM)
+ *
+ *         All matrices in the batch share shape, leading dimensions and scalars; consecutive
+ *         matrices are separated by fixed element strides. One call dispatches the whole batch
+ *         (threaded across matrices like MlasGemmBatch), removing the per-matrix setup that
+ *         dominates batches of small GEMMs. A stride of zero broadcasts that operand across
+ *         the batch (e.g. one shared B for every A).
+ *
+ * @param TransA     Supplies the transpose operation for matrix A.
+ * @param TransB     Supplies the transpose operation for matrix B.
+ * @param M          Supplies the number of rows of matrix A and matrix C.
+ * @param N          Supplies the number of columns of matrix B and matrix C.
+ * @param K          Supplies the number of columns of matrix A and the number
+                     of rows of matrix B.
+ * @param alpha      Supplies the scalar alpha multiplier (see SGEMM definition).
+ * @param A          Supplies the address of the first matrix A.
+ * @param lda        Supplies the first dimension of each matrix A.
+ * @param StrideA    Supplies the element stride between consecutive A matrices.
+ * @param B          Supplies the address of the first matrix B.
+ * @param ldb        Supplies the first dimension of each matrix B.
+ * @param StrideB    Supplies the element stride between consecutive B matrices.
+ * @param beta       Supplies the scalar beta multiplier (see SGEMM definition).
+ * @param C          Supplies the address of the first matrix C.
+ * @param ldc        Supplies the first dimension of each matrix C.
+ * @param StrideC    Supplies the element stride between consecutive C matrices.
+ * @param BatchSize  Supplies the number of multiplications in this batch.
+ * @param ThreadPool Supplies the thread pool object to use, else nullptr if the
+                     base library threading support should be used.
+ */
+void
+MLASCALL
+MlasGemmStridedBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    size_t StrideA,
+    const float* B,
+    size_t ldb,
+    size_t StrideB,
+    float beta,
+    float* C,
+    size_t ldc,
+    size_t StrideC,
+    size_t BatchSize,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 /**
  * @brief  Single precision matrix/matrix multiply operation (SGEMM)
  *
@@ -700,6 +753,23 @@ MlasGemmPackB(
     void* PackedB
     );
 
+/**
+ * @brief Multi-threaded variant of MlasGemmPackB. K-dimension slices of matrix B pack to
+ *        disjoint destination regions, so the pack fans out across the thread pool; the
+ *        resulting buffer layout is identical to the single threaded overload.
+ */
+void
+MLASCALL
+MlasGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 size_t
 MLASCALL
 MlasGemmPackBSize(
@@ -1203,6 +1273,31 @@ MlasQuantizeLinear(
     OutputType ZeroPoint
     );
 
+/**
+ * @brief Quantize a float buffer with a fused leading ReLU (one pass over the data instead of
+ *        an activation sweep followed by a quantize sweep). Equivalent to applying ReLU to the
+ *        input and then MlasQuantizeLinear with the same parameters.
+ */
+void
+MLASCALL
+MlasQuantizeLinearRelu(
+    const float* Input,
+    int8_t* Output,
+    size_t N,
+    float Scale,
+    int8_t ZeroPoint
+    );
+
+void
+MLASCALL
+MlasQuantizeLinearRelu(
+    const float* Input,
+    uint8_t* Output,
+    size_t N,
+    float Scale,
+    uint8_t ZeroPoint
+    );
+
 void
 MLASCALL
 MlasQuantizeLinearU4(
@@ -1969,6 +2064,19 @@ MlasNhwcAvgPool(
 struct MlasFlashAttentionThreadedArgs {
     int batch_size;
     int num_heads;
+    // Number of K/V heads. 0 (default) or num_heads selects regular multi-head attention;
+    // a divisor of num_heads shares each K/V head across num_heads / kv_num_heads query
+    // heads (grouped-query attention), with key/value laid out per K/V head.
+    int kv_num_heads = 0;
+    // Optional fused rotary embedding: when rope_cos/rope_sin are non-null and rope_dim > 0,
+    // the kernel rotates the first rope_dim (even, <= qk_head_size) elements of each Q and K
+    // row while loading blocks - half-split (NeoX) convention, pairing element d with
+    // d + rope_dim / 2. The caches are laid out [position, rope_dim / 2] and indexed by the
+    // row's absolute sequence position. When enabled, buffer_size_per_thread must include an
+    // additional (q_block_size + kv_block_size) * qk_head_size floats for the rotated blocks.
+    const float* rope_cos = nullptr;
+    const float* rope_sin = nullptr;
+    int rope_dim = 0;
     int q_sequence_length;
     int kv_sequence_length;
     int qk_head_size;
@@ -2,6 +2,46 @@
 
 #include "mlasi.h"
 
+//
+// Applies rotary embedding (half-split convention) to the first RotaryDim elements of each
+// row, copying the remaining elements through, so attention consumes rotated Q/K blocks
+// without a separate rotation pass writing the full tensors back to memory.
+//
+
+static
+void
+MlasApplyRotaryEmbedding(
+    const float* Input,
+    float* Output,
+    ptrdiff_t RowCount,
+    ptrdiff_t HeadSize,
+    ptrdiff_t RotaryDim,
+    ptrdiff_t PositionBase,
+    const float* CosCache,
+    const float* SinCache
+    )
+{
+    const ptrdiff_t half = RotaryDim / 2;
+
+    for (ptrdiff_t row = 0; row < RowCount; row++) {
+        const float* input_row = Input + row * HeadSize;
+        float* output_row = Output + row * HeadSize;
+        const float* cos_row = CosCache + (PositionBase + row) * half;
+        const float* sin_row = SinCache + (PositionBase + row) * half;
+
+        for (ptrdiff_t d = 0; d < half; d++) {
+            const float x0 = input_row[d];
+            const float x1 = input_row[d + half];
+            output_row[d] = x0 * cos_row[d] - x1 * sin_row[d];
+            output_row[d + half] = x0 * sin_row[d] + x1 * cos_row[d];
+        }
+
+        for (ptrdiff_t d = RotaryDim; d < HeadSize; d++) {
+            output_row[d] = input_row[d];
+        }
+    }
+}
+
 void
 MlasFlashAttentionThreaded(
     void* argptr,
@@ -13,6 +53,8 @@ MlasFlashAttentionThreaded(
     ptrdiff_t kv_block_size = static_cast<ptrdiff_t>(args->kv_block_size);
     ptrdiff_t batch_size = static_cast<ptrdiff_t>(args->batch_size);
     ptrdiff_t num_heads = static_cast<ptrdiff_t>(args->num_heads);
+    ptrdiff_t kv_num_heads = args->kv_num_heads > 0 ? static_cast<ptrdiff_t>(args->kv_num_heads) : num_heads;
+    ptrdiff_t q_heads_per_kv_head = num_heads / kv_num_heads;
     ptrdiff_t q_sequence_length = static_cast<ptrdiff_t>(args->q_sequence_length);
     ptrdiff_t kv_sequence_length = static_cast<ptrdiff_t>(args->kv_sequence_length);
     ptrdiff_t qk_head_size = static_cast<ptrdiff_t>(args->qk_head_size);
@@ -59,6 +101,16 @@ MlasFlashAttentionThreaded(
         }
         float* intermediate = m + q_block_size;
         float* temp_output = intermediate + q_block_size * kv_block_size;
+
+        // optional fused rotary embedding: rotated blocks live after the temporary output (the
+        // caller sized buffer_size_per_thread for them when the caches are set)
+        const bool has_rope = args->rope_cos != nullptr && args->rope_sin != nullptr && args->rope_dim > 0;
+        float* rotated_q = nullptr;
+        float* rotated_k = nullptr;
+        if (has_rope) {
+            rotated_q = temp_output + q_block_size * v_head_size;
+            rotated_k = rotated_q + q_block_size * qk_head_size;
+        }
         float negmax = 0;
 
         for (ptrdiff_t ir = 0; ir < kv_sequence_length; ir += kv_block_size) {
@@ -72,13 +124,29 @@ MlasFlashAttentionThreaded(
                 O = diag(exp(diff)) * O + S * V[batch_idx, head_idx, ir:ir+kv_block_size, :]
             */
             ptrdiff_t h = batch_idx * num_heads + head_idx;
+            // with grouped-query attention consecutive query heads share one K/V head
+            ptrdiff_t kv_h = batch_idx * kv_num_heads + head_idx / q_heads_per_kv_head;
             const float* inputQ = query + (h * q_sequence_length + q_idx) * qk_head_size;
-            const float* inputK = key + (h * kv_sequence_length + ir) * qk_head_size;
-            const float* inputV = value + (h * kv_sequence_length + ir) * v_head_size;
+            const float* inputK = key + (kv_h * kv_sequence_length + ir) * qk_head_size;
+            const float* inputV = value + (kv_h * kv_sequence_length + ir) * v_head_size;
 
             size_t row_size_q_capped = static_cast<size_t>(std::min(q_block_size, q_sequence_length - q_idx));
             size_t row_size_kv_capped = static_cast<size_t>(std::min(kv_block_size, kv_sequence_length - ir));
 
+            if (has_rope) {
+                if (ir == 0) {
+                    // the Q block is loop invariant; rotate it once per block
+                    MlasApplyRotaryEmbedding(inputQ, rotated_q, static_cast<ptrdiff_t>(row_size_q_capped),
+                                             qk_head_size, args->rope_dim, q_idx,
+                                             args->rope_cos, args->rope_sin);
+                }
+                MlasApplyRotaryEmbedding(inputK, rotated_k, static_cast<ptrdiff_t>(row_size_kv_capped),
+                                         qk_head_size, args->rope_dim, ir,
+                                         args->rope_cos, args->rope_sin);
+                inputQ = rotated_q;
+                inputK = rotated_k;
+            }
+
             MlasSgemmOperation(CBLAS_TRANSPOSE::CblasNoTrans,
                      CBLAS_TRANSPOSE::CblasTrans,
                      row_size_q_capped,
@@ -17,6 +17,9 @@ Abstract:
 
 #include "mlasi.h"
 
+#include <cstdlib>
+#include <cstring>
+
 #include <thread>
 #include <mutex>
 
@@ -307,6 +310,29 @@ Return Value:
     __cpuid(1, Cpuid1[0], Cpuid1[1], Cpuid1[2], Cpuid1[3]);
 #endif
 
+    //
+    // Optionally cap the dispatch level via MLAS_DISPATCH_LEVEL (sse2, avx, avx2 or avx512).
+    // An external autotuner can persist the most profitable kernel set for a machine or
+    // workload and pin it here; unset or unrecognized values keep full automatic dispatch.
+    // The cap works by masking the corresponding CPUID feature bits before the checks below.
+    //
+
+    unsigned DispatchLevelCap = 3;
+
+    if (const char* DispatchLevel = std::getenv("MLAS_DISPATCH_LEVEL"); DispatchLevel != nullptr) {
+        if (strcmp(DispatchLevel, "sse2") == 0) {
+            DispatchLevelCap = 0;
+        } else if (strcmp(DispatchLevel, "avx") == 0) {
+            DispatchLevelCap = 1;
+        } else if (strcmp(DispatchLevel, "avx2") == 0) {
+            DispatchLevelCap = 2;
+        }
+    }
+
+    if (DispatchLevelCap < 1) {
+        Cpuid1[2] &= ~0x10000000u;  // AVX
+    }
+
 #if defined(_MSC_VER)
 
     //
@@ -372,6 +398,15 @@ Return Value:
             __cpuid_count(7, 0, Cpuid7[0], Cpuid7[1], Cpuid7[2], Cpuid7[3]);
 #endif
 
+            if (DispatchLevelCap < 2) {
+                Cpuid7[1] &= ~0x20u;  // AVX2
+            }
+
+            if (DispatchLevelCap < 3) {
+                Cpuid7[1] &= ~0x10000u;                                // AVX512F
+                Cpuid7[3] &= ~((1u << 22) | (1u << 24) | (1u << 25));  // AMX-BF16/TILE/INT8
+            }
+
             if (((Cpuid1[2] & 0x1000) != 0) && ((Cpuid7[1] & 0x20) != 0)) {
 
                 this->Avx2Supported_ = true;
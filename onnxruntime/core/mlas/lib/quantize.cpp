@@ -600,6 +600,68 @@ MlasQuantizeLinearU4Kernel(
     MlasQuantizeLinearInt4Kernel<false>(Input, Output, N, Scale, ZeroPoint);
 }
 
+template<typename OutputType>
+static
+void
+MlasQuantizeLinearReluKernelHelper(
+    const float* Input,
+    OutputType* Output,
+    size_t N,
+    float Scale,
+    OutputType ZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine quantizes the input buffer with a fused leading ReLU. A ReLU
+    clamps the pre-scale value at zero, which lands exactly on the zero point
+    after quantization, so the fusion only raises the lower clamp of the
+    single-pass quantize kernel - one sweep over the data instead of an
+    activation pass followed by a quantize pass.
+
+--*/
+{
+    constexpr int32_t MinimumValue = std::numeric_limits<OutputType>::lowest();
+    constexpr int32_t MaximumValue = std::numeric_limits<OutputType>::max();
+
+    const float LowerBound = std::max(float(MinimumValue - ZeroPoint), 0.0f);
+
+    auto ScaleVector = MlasBroadcastFloat32x4(Scale);
+    auto MinimumValueVector = MlasBroadcastFloat32x4(LowerBound);
+    auto MaximumValueVector = MlasBroadcastFloat32x4(float(MaximumValue - ZeroPoint));
+    auto ZeroPointVector = MlasBroadcastInt32x4(ZeroPoint);
+
+    while (N >= 4) {
+
+        auto FloatVector = MlasLoadFloat32x4(Input);
+        auto IntegerVector = MlasQuantizeLinearVector(FloatVector, ScaleVector,
+            MinimumValueVector, MaximumValueVector, ZeroPointVector);
+
+        IntegerVector = MlasQuantizeLinearPackBytes<OutputType>(IntegerVector);
+        MlasQuantizeLinearStore4PackedValues(IntegerVector, Output);
+
+        Input += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    for (size_t n = 0; n < N; n++) {
+
+#if defined(MLAS_NEON64_INTRINSICS)
+        auto FloatVector = vld1q_dup_f32(Input + n);
+#elif defined(MLAS_LSX_INTRINSICS)
+        MLAS_FLOAT32X4 FloatVector = (MLAS_FLOAT32X4)__lsx_vldrepl_w(Input+n, 0);
+#else
+        auto FloatVector = _mm_load_ss(Input + n);
+#endif
+        auto IntegerVector = MlasQuantizeLinearVector(FloatVector, ScaleVector,
+            MinimumValueVector, MaximumValueVector, ZeroPointVector);
+
+        MlasQuantizeLinearStoreSingleValue(IntegerVector, &Output[n]);
+    }
+}
+
 void
 MLASCALL
 MlasQuantizeLinearS8Kernel(
@@ -2119,3 +2181,60 @@ Return Value:
     MlasReduceMinimumMaximumF32Kernel(Input, Min, Max, N);
 #endif
 }
+
+//
+// Fused ReLU + QuantizeLinear entry points. See mlas.h; the SIMD kernel raises the lower
+// clamp of the single-pass quantize kernel, the portable fallback fuses the two loops.
+//
+
+template<typename OutputType>
+static
+void
+MlasQuantizeLinearReluImpl(
+    const float* Input,
+    OutputType* Output,
+    size_t N,
+    float Scale,
+    OutputType ZeroPoint
+    )
+{
+#if defined(MLAS_NEON64_INTRINSICS) || defined(MLAS_SSE2_INTRINSICS) || \
+    defined(MLAS_LSX_INTRINSICS)
+    MlasQuantizeLinearReluKernelHelper<OutputType>(Input, Output, N, Scale, ZeroPoint);
+#else
+    constexpr int32_t MaximumValue = std::numeric_limits<OutputType>::max();
+
+    for (size_t n = 0; n < N; n++) {
+        float FloatValue = std::nearbyintf(std::max(Input[n], 0.0f) / Scale) + float(ZeroPoint);
+        FloatValue = std::max(FloatValue, float(ZeroPoint));
+        FloatValue = std::min(FloatValue, float(MaximumValue));
+        Output[n] = (OutputType)(int32_t)FloatValue;
+    }
+#endif
+}
+
+void
+MLASCALL
+MlasQuantizeLinearRelu(
+    const float* Input,
+    int8_t* Output,
+    size_t N,
+    float Scale,
+    int8_t ZeroPoint
+    )
+{
+    MlasQuantizeLinearReluImpl<int8_t>(Input, Output, N, Scale, ZeroPoint);
+}
+
+void
+MLASCALL
+MlasQuantizeLinearRelu(
+    const float* Input,
+    uint8_t* Output,
+    size_t N,
+    float Scale,
+    uint8_t ZeroPoint
+    )
+{
+    MlasQuantizeLinearReluImpl<uint8_t>(Input, Output, N, Scale, ZeroPoint);
+}
@@ -17,6 +17,8 @@ Abstract:
 
 #include "mlasi.h"
 
+#include <vector>
+
 //
 // Define the number of rows from matrix A to transpose to a local buffer.
 //
@@ -1630,6 +1632,55 @@ MlasGemmBatch(
             TransA, TransB, M, N, K, &(Data[GemmIdx]), ThreadIdx);
     });
 }
+
+void
+MLASCALL
+MlasGemmStridedBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    size_t StrideA,
+    const float* B,
+    size_t ldb,
+    size_t StrideB,
+    float beta,
+    float* C,
+    size_t ldc,
+    size_t StrideC,
+    size_t BatchSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the strided batched single precision matrix/matrix
+    multiply operation (SGEMM). The per-matrix data parameters are derived from
+    fixed element strides, so callers avoid building a parameter array and pay
+    one dispatch for the whole batch. A stride of zero broadcasts the operand.
+
+--*/
+{
+    std::vector<MLAS_SGEMM_DATA_PARAMS> Data(BatchSize);
+
+    for (size_t b = 0; b < BatchSize; b++) {
+        Data[b].A = A + b * StrideA;
+        Data[b].lda = lda;
+        Data[b].B = B + b * StrideB;
+        Data[b].ldb = ldb;
+        Data[b].C = C + b * StrideC;
+        Data[b].ldc = ldc;
+        Data[b].alpha = alpha;
+        Data[b].beta = beta;
+    }
+
+    MlasGemmBatch(TransA, TransB, M, N, K, Data.data(), BatchSize, ThreadPool);
+}
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(pop)
 #endif
@@ -1734,3 +1785,46 @@ Return Value:
         PackedB = (float*)PackedB + AlignedN * CountK;
     }
 }
+
+void
+MLASCALL
+MlasGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine packs the contents of matrix B to the destination buffer using
+    multiple threads. Slices of matrix B along the K dimension pack to disjoint,
+    directly computable regions of the destination buffer, so they are packed in
+    parallel; the resulting layout is identical to the single threaded overload.
+    Multi-gigabyte packed models then pack at memory bandwidth instead of on one
+    core.
+
+--*/
+{
+    const size_t AlignedN =
+        (N + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) & ~(MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1);
+
+    const size_t KChunks = (K + MLAS_SGEMM_PACKED_STRIDEK - 1) / MLAS_SGEMM_PACKED_STRIDEK;
+
+    MlasTrySimpleParallel(ThreadPool, ptrdiff_t(KChunks), [=](ptrdiff_t ChunkIndex) {
+
+        const size_t k = size_t(ChunkIndex) * MLAS_SGEMM_PACKED_STRIDEK;
+        const size_t CountK = std::min(K - k, size_t(MLAS_SGEMM_PACKED_STRIDEK));
+        float* PackedSlice = (float*)PackedB + AlignedN * k;
+
+        if (TransB == CblasNoTrans) {
+            MlasSgemmCopyPackB(PackedSlice, B + k * ldb, ldb, N, CountK);
+        } else {
+            MlasSgemmTransposePackB(PackedSlice, B + k, ldb, N, CountK);
+        }
+    });
+}
@@ -204,8 +204,19 @@ bool IsQOrDQScalePositiveConstantScalar(
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
 bool MatchQNode(const Node& node) {
-  return graph_utils::IsSupportedOptypeVersionAndDomain(node, QOpName, {10, 13, 19, 21, 23}) ||
-         graph_utils::IsSupportedOptypeVersionAndDomain(node, QOpName, {1}, kMSDomain);
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, QOpName, {10, 13, 19, 21, 23}) &&
+      !graph_utils::IsSupportedOptypeVersionAndDomain(node, QOpName, {1}, kMSDomain)) {
+    return false;
+  }
+
+  // a contrib Q carrying a fused activation no longer has pure quantize semantics, so it
+  // must not participate in QDQ pattern matching/cleanup
+  const auto* fuse_relu_attr = graph_utils::GetNodeAttribute(node, "fuse_relu");
+  if (fuse_relu_attr != nullptr && fuse_relu_attr->i() != 0) {
+    return false;
+  }
+
+  return true;
 }
 
 bool MatchDQNode(const Node& node) {
@@ -47,22 +47,112 @@ Status ReluQuantFusion::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_
 
   using ONNX_TENSOR_ELEM_TYPE = ONNX_NAMESPACE::TensorProto::DataType;
   Initializer zero_point(*zp_tensor_proto, graph.ModelPath());
-  if (zero_point.size() != 1 ||
-      (zero_point.data_type() == ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_INT8 &&
-       zero_point.data<int8_t>()[0] != -128) ||
-      (zero_point.data_type() == ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_UINT8 &&
-       zero_point.data<uint8_t>()[0] != 0) ||
-      (zero_point.data_type() == ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_INT16 &&
-       zero_point.data<int16_t>()[0] != -32768) ||
-      (zero_point.data_type() == ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_UINT16 &&
-       zero_point.data<uint16_t>()[0] != 0)) {
+  if (zero_point.size() != 1) {
     return Status::OK();
   }
 
-  if (graph_utils::RemoveNode(graph, node)) {
-    rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+  const auto zp_type = zero_point.data_type();
+  const bool zp_is_type_min =
+      (zp_type == ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_INT8 &&
+       zero_point.data<int8_t>()[0] == -128) ||
+      (zp_type == ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_UINT8 &&
+       zero_point.data<uint8_t>()[0] == 0) ||
+      (zp_type == ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_INT16 &&
+       zero_point.data<int16_t>()[0] == -32768) ||
+      (zp_type == ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_UINT16 &&
+       zero_point.data<uint16_t>()[0] == 0);
+
+  if (zp_is_type_min) {
+    // quantization already saturates at the zero point, so the Relu is a no-op and can go
+    if (graph_utils::RemoveNode(graph, node)) {
+      rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+    }
+    return Status::OK();
+  }
+
+#if !defined(DISABLE_CONTRIB_OPS)
+  // The Relu is not removable (values below the zero point would no longer clamp to it), but
+  // for 8-bit outputs it can fold into the quantization kernel itself: replace the pair with
+  // the contrib QuantizeLinear carrying fuse_relu=1, which runs MLAS's fused ReLU+quantize
+  // sweep instead of two passes over the data.
+  if (zp_type != ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_INT8 &&
+      zp_type != ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_UINT8) {
+    return Status::OK();
   }
 
+  // the fused kernel only handles float input
+  const auto* x_type = node.InputDefs()[0]->TypeAsProto();
+  if (x_type == nullptr || !x_type->tensor_type().has_elem_type() ||
+      x_type->tensor_type().elem_type() != ONNX_TENSOR_ELEM_TYPE::TensorProto_DataType_FLOAT) {
+    return Status::OK();
+  }
+
+  // only fuse plain per-tensor/per-axis quantization: any attribute other than axis
+  // (block_size, output_dtype, saturate, ...) has no contrib-op equivalent
+  for (const auto& [attr_name, attr_proto] : q_node.GetAttributes()) {
+    ORT_UNUSED_PARAMETER(attr_proto);
+    if (attr_name != "axis") {
+      return Status::OK();
+    }
+  }
+
+  // don't break QDQ node units: DQ -> target -> Relu -> Q is matched by the QDQ selectors
+  // that run after this rule (e.g. QLinearConv with its fused activation), so leave the Relu
+  // in place there. A Relu fed directly by a DQ is not part of any unit and can fuse.
+  if (const Node* x_producer = graph.GetProducerNode(node.InputDefs()[0]->Name());
+      x_producer != nullptr && !QDQ::MatchDQNode(*x_producer)) {
+    for (auto it = x_producer->InputNodesBegin(); it != x_producer->InputNodesEnd(); ++it) {
+      if (QDQ::MatchDQNode(*it)) {
+        return Status::OK();
+      }
+    }
+  }
+
+  std::vector<NodeArg*> fused_input_defs{node.MutableInputDefs()[0], q_input_defs[1],
+                                         q_input_defs[zp_idx]};
+  Node& fused_q_node = graph.AddNode(graph.GenerateNodeName(q_node.Name() + "_with_relu"),
+                                     QDQ::QOpName,
+                                     "QuantizeLinear with fused leading Relu",
+                                     fused_input_defs,
+                                     q_node.MutableOutputDefs(),
+                                     {},
+                                     kMSDomain);
+  if (const auto* axis_attr = graph_utils::GetNodeAttribute(q_node, "axis")) {
+    fused_q_node.AddAttributeProto(*axis_attr);
+  }
+  fused_q_node.AddAttribute("fuse_relu", static_cast<int64_t>(1));
+  fused_q_node.SetExecutionProviderType(q_node.GetExecutionProviderType());
+
+  // move the Relu's input edge (if its producer is a node) to the fused node's input 0
+  for (const auto& input_edge : graph_utils::GraphEdge::GetNodeInputEdges(node)) {
+    graph.AddEdge(input_edge.src_node, fused_q_node.Index(), input_edge.src_arg_index, 0);
+    graph.RemoveEdge(input_edge.src_node, input_edge.dst_node, input_edge.src_arg_index,
+                     input_edge.dst_arg_index);
+  }
+
+  // move the Q node's scale/zero-point input edges (usually initializers without edges) and
+  // all of its output edges
+  for (const auto& input_edge : graph_utils::GraphEdge::GetNodeInputEdges(q_node)) {
+    if (input_edge.dst_arg_index >= 1) {
+      graph.AddEdge(input_edge.src_node, fused_q_node.Index(), input_edge.src_arg_index,
+                    input_edge.dst_arg_index);
+    }
+    graph.RemoveEdge(input_edge.src_node, input_edge.dst_node, input_edge.src_arg_index,
+                     input_edge.dst_arg_index);
+  }
+  for (const auto& output_edge : graph_utils::GraphEdge::GetNodeOutputEdges(q_node)) {
+    graph.AddEdge(fused_q_node.Index(), output_edge.dst_node, output_edge.src_arg_index,
+                  output_edge.dst_arg_index);
+    graph.RemoveEdge(output_edge.src_node, output_edge.dst_node, output_edge.src_arg_index,
+                     output_edge.dst_arg_index);
+  }
+
+  ORT_ENFORCE(graph.RemoveNode(node.Index()));
+  ORT_ENFORCE(graph.RemoveNode(q_node.Index()));
+
+  rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+#endif  // !defined(DISABLE_CONTRIB_OPS)
+
   return Status::OK();
 }
 }  // namespace onnxruntime
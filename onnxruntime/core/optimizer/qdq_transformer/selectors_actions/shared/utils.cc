@@ -305,35 +305,35 @@ SelectorManager::SelectorManager() {
 std::vector<NodeGroup> SelectorManager::GetQDQSelections(const GraphViewer& graph_viewer,
                                                          const logging::Logger& logger) const {
   std::vector<NodeGroup> qdq_selections;
-  for (auto index : graph_viewer.GetNodesInTopologicalOrder()) {
-    const auto* node = graph_viewer.GetNode(index);
-    // post layout transformation all the layout sensitive nodes are converted to domain
-    // kMSInternalNHWCDomain. Therefore need to allow this domain as well.
-    // Allow kMSDomain for contrib op like Gelu
-    if (node->Domain() != kOnnxDomain && node->Domain() != kMSInternalNHWCDomain && node->Domain() != kMSDomain) {
-      continue;
-    }
-
-    auto op_rule = op_type_to_selectors_map_.find(node->OpType());
-    if (op_rule == op_type_to_selectors_map_.cend()) {
-      continue;
-    }
-
-    const auto& op_versions_and_selector = *op_rule->second;
-
-    // check the supported versions if specified
-    const auto& versions = op_versions_and_selector.op_versions_map.find(node->OpType())->second;
-    if (!versions.empty()) {
-      if (std::find(versions.cbegin(), versions.cend(), node->SinceVersion()) == versions.cend()) {
-        LOGS(logger, VERBOSE) << "Op version is not supported for" << node->OpType();
+  // Only op types with a registered selector can anchor a QDQ group, so consult the viewer's
+  // op-type index instead of scanning every node. Selections are disjoint groups, so iterating
+  // per op type (topological within each type) instead of globally topological does not change
+  // the selected groups.
+  for (const auto& [selector_op_type, op_rule] : op_type_to_selectors_map_) {
+    const auto& op_versions_and_selector = *op_rule;
+    for (auto index : graph_viewer.GetNodesByOpType(selector_op_type)) {
+      const auto* node = graph_viewer.GetNode(index);
+      // post layout transformation all the layout sensitive nodes are converted to domain
+      // kMSInternalNHWCDomain. Therefore need to allow this domain as well.
+      // Allow kMSDomain for contrib op like Gelu
+      if (node->Domain() != kOnnxDomain && node->Domain() != kMSInternalNHWCDomain && node->Domain() != kMSDomain) {
         continue;
       }
-    }
 
-    const auto qdq_node_group_selection = op_versions_and_selector.selector->GetQDQSelection(graph_viewer, *node);
-    if (qdq_node_group_selection.has_value()) {
-      const auto& qdq_group = *qdq_node_group_selection;
-      qdq_selections.push_back(qdq_group);
+      // check the supported versions if specified
+      const auto& versions = op_versions_and_selector.op_versions_map.find(node->OpType())->second;
+      if (!versions.empty()) {
+        if (std::find(versions.cbegin(), versions.cend(), node->SinceVersion()) == versions.cend()) {
+          LOGS(logger, VERBOSE) << "Op version is not supported for" << node->OpType();
+          continue;
+        }
+      }
+
+      const auto qdq_node_group_selection = op_versions_and_selector.selector->GetQDQSelection(graph_viewer, *node);
+      if (qdq_node_group_selection.has_value()) {
+        const auto& qdq_group = *qdq_node_group_selection;
+        qdq_selections.push_back(qdq_group);
+      }
     }
   }
 
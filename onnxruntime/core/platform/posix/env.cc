@@ -33,6 +33,7 @@ limitations under the License.
 
 #include <iostream>
 #include <optional>
+#include <sstream>
 #include <thread>
 #include <utility>  // for std::forward
 #include <vector>
@@ -227,6 +228,32 @@ class PosixThread : public EnvThread {
           LOGS_DEFAULT(VERBOSE) << "pthread_setaffinity_np succeed for thread: " << syscall(SYS_gettid)
                                 << ", index: " << p->index
                                 << ", mask: " << *p->affinity;
+
+          // Read the affinity back so placement can be verified from the log: the kernel (or a
+          // cgroup cpuset) may silently clamp the requested mask, which otherwise only shows up
+          // as mysterious throughput loss.
+          cpu_set_t effective;
+          CPU_ZERO(&effective);
+          if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &effective) == 0) {
+            std::ostringstream effective_cpus;
+            bool clamped = false;
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+              if (CPU_ISSET(cpu, &effective)) {
+                effective_cpus << cpu << " ";
+              }
+              if (CPU_ISSET(cpu, &cpuset) && !CPU_ISSET(cpu, &effective)) {
+                clamped = true;
+              }
+            }
+            if (clamped) {
+              LOGS_DEFAULT(WARNING) << "Thread affinity for thread index " << p->index
+                                    << " was clamped (likely by a cgroup cpuset). Requested: " << *p->affinity
+                                    << ", effective cpus: " << effective_cpus.str();
+            } else {
+              LOGS_DEFAULT(INFO) << "Thread index " << p->index
+                                 << " pinned, effective cpus: " << effective_cpus.str();
+            }
+          }
         } else {
           errno = ret;
           auto [err_no, err_msg] = GetErrnoInfo();
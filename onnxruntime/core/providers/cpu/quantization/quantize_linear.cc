@@ -50,6 +50,11 @@ class QuantizeLinear final : public OpKernel {
       block_size_ = 0;
     }
 
+    // set by the optimizer on the contrib op when a preceding Relu was fused in
+    if (!info.GetAttr<int64_t>("fuse_relu", &fuse_relu_).IsOK()) {
+      fuse_relu_ = 0;
+    }
+
     ORT_ENFORCE(block_size_ >= 0, "'block_size' must be non-negative.");
   }
 
@@ -59,6 +64,7 @@ class QuantizeLinear final : public OpKernel {
   int64_t axis_;
   int64_t saturate_;
   int64_t block_size_;
+  int64_t fuse_relu_{0};
 };
 
 static void PrepareForQDQ(const TensorShape& input_shape,
@@ -826,6 +832,31 @@ Status QuantizeLinear<T>::Compute(OpKernelContext* ctx) const {
   const T* zero_point = y_zero_point != nullptr ? y_zero_point->Data<T>() : nullptr;
   T* output = y.MutableData<T>();
 
+  if (fuse_relu_) {
+    // the ReluQuantFusion optimizer only sets fuse_relu for float input, 8-bit output and
+    // non-blocked quantization; reject anything else rather than silently dropping the ReLU
+    if constexpr (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value) {
+      ORT_RETURN_IF_NOT(block_size_ == 0 && x.IsDataType<float>(),
+                        "fuse_relu requires float input and non-blocked quantization.");
+      const float* input = x.Data<float>();
+      const float* scale = y_scale.Data<float>();
+      T* out = output;
+      for (int64_t n = 0; n < process_block_count; n++) {
+        for (int64_t bd = 0; bd < broadcast_dim; bd++) {
+          ParQuantizeLinearReluStd(input, out, static_cast<size_t>(process_block_size), scale[bd],
+                                   zero_point != nullptr ? zero_point[bd] : static_cast<T>(0),
+                                   ctx->GetOperatorThreadPool());
+          input += process_block_size;
+          out += process_block_size;
+        }
+      }
+      return Status::OK();
+    } else {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "fuse_relu is only supported for int8/uint8 outputs.");
+    }
+  }
+
   constexpr int output_type_group_ =
       boost::mp11::mp_contains<TypeList<Int4x2, UInt4x2>, T>::value ? 2
 #if !defined(DISABLE_FLOAT8_TYPES)
@@ -117,6 +117,17 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
       reinterpret_cast<std::string*>(dst_base)[dst_offset / element_bytes] =
           reinterpret_cast<const std::string*>(src_base)[src_offset / element_bytes];
     } else {
+#if defined(__GNUC__) || defined(__clang__)
+      // Embedding-style lookups jump to effectively random rows of a table far larger than
+      // cache, so each memcpy stalls on a fresh miss. Prefetch the row a few indices ahead
+      // (same batch, so only the index changes) to overlap those misses with the current copy.
+      constexpr int64_t kPrefetchDistance = 4;
+      if (i + kPrefetchDistance < N) {
+        Tin prefetch_idx = indices_data[i + kPrefetchDistance];
+        prefetch_idx = prefetch_idx < 0 ? prefetch_idx + static_cast<Tin>(axis_dim_limit) : prefetch_idx;
+        __builtin_prefetch(src_base + src_offset_batch + prefetch_idx * block_size, 0 /*read*/, 1 /*low temporal*/);
+      }
+#endif
       memcpy(dst_base + dst_offset, src_base + src_offset, narrow<size_t>(block_size));
     }
   };
@@ -3,6 +3,7 @@
 
 #include "core/providers/cpu/tensor/pad.h"
 
+#include "core/framework/copy.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/providers/common.h"
 #include "core/providers/cpu/tensor/utils.h"
@@ -491,7 +492,39 @@ static Status PadImpl(OpKernelContext* ctx,
   ExtentAxisCounters input_counters(input_extents);
 
   switch (mode) {
-    case Mode::Constant:
+    case Mode::Constant: {
+      // Large outputs route through the shared strided-copy engine (core/framework/copy.h):
+      // fill the whole output with the pad value, then copy the (possibly cropped) input
+      // block into the interior as one parallel strided copy. The interior is written twice,
+      // but both passes parallelize over the intra-op pool, which beats the single-threaded
+      // interleaved sweep once outputs get large. Small outputs keep the serial walk below.
+      concurrency::ThreadPool* pad_tp = ctx->GetOperatorThreadPool();
+      constexpr int64_t kParallelPadMinElements = 64 * 1024;
+      if (pad_tp != nullptr && output_shape.Size() >= kParallelPadMinElements) {
+        T* output_base = reinterpret_cast<T*>(output_tensor.MutableDataRaw());
+        concurrency::ThreadPool::TryParallelFor(
+            pad_tp, onnxruntime::narrow<std::ptrdiff_t>(output_shape.Size()),
+            TensorOpCost{0.0, static_cast<double>(sizeof(T)), 1.0},
+            [output_base, value](std::ptrdiff_t begin, std::ptrdiff_t end) {
+              std::fill(output_base + begin, output_base + end, value);
+            });
+
+        TensorPitches input_pitches(reshaped_input_dims);
+        TensorShapeVector src_strides(input_pitches.begin(), input_pitches.end());
+        TensorShapeVector dst_strides(output_pitches.begin(), output_pitches.end());
+        std::ptrdiff_t src_offset = 0;
+        std::ptrdiff_t dst_offset = 0;
+        for (size_t i = 0; i < new_dims_count; i++) {
+          src_offset += static_cast<std::ptrdiff_t>(input_starts[i] * src_strides[i]);
+          dst_offset += static_cast<std::ptrdiff_t>(reshaped_pad[i] * dst_strides[i]);
+        }
+
+        StridedCopy<T>(pad_tp, output_base + dst_offset, dst_strides, TensorShape(input_extents),
+                       reinterpret_cast<const T*>(input_tensor.DataRaw()) + src_offset,
+                       src_strides);
+        break;
+      }
+
       // Loop over the output tensor, writing out padding between the blocks of copied data
       // On loop entry, 'pad' is already set to the first continuous block of padding, and
       // after every pass through the inner loop it gets set to the next continuous pad size.
@@ -520,7 +553,7 @@ static Status PadImpl(OpKernelContext* ctx,
           alignSkip += inner_pitch * SafeInt<size_t>(prePad);
         }
       }
-      break;
+    } break;
 
     case Mode::Edge:
       // Loop over the output tensor, writing out padding between the blocks of copied data
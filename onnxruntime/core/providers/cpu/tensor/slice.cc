@@ -7,6 +7,7 @@
 #include <unordered_map>
 
 #include "core/common/narrow.h"
+#include "core/framework/copy.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/providers/common.h"
@@ -237,30 +238,47 @@ static Status SliceImpl(OpKernelContext* ctx,
   if (output_shape.Size() == 0)
     return Status::OK();
 
-  // use MutableDataRaw as actual data type in tensor may not match as we templatize on data size
-  T* output = reinterpret_cast<T*>(output_tensor.MutableDataRaw());
-  const auto* output_end = output + output_tensor.Shape().Size();
-
-  auto create_output = [&output, &output_end](SliceIterator<T>& slice_input_iterator) {
-    while (output < output_end) {
-      output = slice_input_iterator.CopyContiguousInnermostAxes(output);
-    }
+  // Slicing is a strided copy: the source strides are the input strides scaled by the
+  // per-axis steps, offset to the start element. Route it through the shared strided-copy
+  // engine (core/framework/copy.h), which parallelizes over the intra-op pool where the
+  // copied size warrants it.
+  const bool flattened = compute_metadata.p_flattened_input_dims_ != nullptr;
+  const TensorShapeVector input_dims =
+      flattened ? compute_metadata.flattened_input_dims_
+                : TensorShapeVector(compute_metadata.input_dimensions_.begin(),
+                                    compute_metadata.input_dimensions_.end());
+  const TensorShapeVector& copy_dims = flattened ? compute_metadata.flattened_output_dims_
+                                                 : compute_metadata.output_dims_;
+
+  const size_t rank = input_dims.size();
+  TensorShapeVector input_strides(rank);
+  int64_t stride = 1;
+  for (size_t i = rank; i > 0; --i) {
+    input_strides[i - 1] = stride;
+    stride *= input_dims[i - 1];
+  }
 
-    ORT_ENFORCE(output == output_end);
-  };
+  TensorShapeVector src_strides(rank);
+  std::ptrdiff_t src_offset = 0;
+  for (size_t i = 0; i < rank; ++i) {
+    src_strides[i] = input_strides[i] * compute_metadata.steps_[i];
+    src_offset += static_cast<std::ptrdiff_t>(compute_metadata.starts_[i] * input_strides[i]);
+  }
 
-  if (compute_metadata.p_flattened_input_dims_) {
-    // If we were able to coalesce the input and output shapes, use the new shapes.
-    auto input_iterator2 =
-        SliceIterator<T>(input_tensor, TensorShape(compute_metadata.flattened_input_dims_), compute_metadata.starts_,
-                         compute_metadata.flattened_output_dims_, compute_metadata.steps_);
-    create_output(input_iterator2);
-  } else {
-    auto input_iterator2 = SliceIterator<T>(input_tensor, compute_metadata.starts_, compute_metadata.output_dims_,
-                                            compute_metadata.steps_);
-    create_output(input_iterator2);
+  TensorShapeVector dst_strides(rank);
+  stride = 1;
+  for (size_t i = rank; i > 0; --i) {
+    dst_strides[i - 1] = stride;
+    stride *= copy_dims[i - 1];
   }
 
+  // use raw data as the actual data type in the tensor may not match since we templatize on
+  // data size
+  T* output = reinterpret_cast<T*>(output_tensor.MutableDataRaw());
+  const T* input = reinterpret_cast<const T*>(input_tensor.DataRaw());
+  StridedCopy<T>(ctx->GetOperatorThreadPool(), output, dst_strides, TensorShape(copy_dims),
+                 input + src_offset, src_strides);
+
   return Status::OK();
 }
 
@@ -2,13 +2,23 @@
 // Licensed under the MIT License.
 
 #include "core/session/IOBinding.h"
+
+#include <cstdlib>
+
 #include "core/common/logging/logging.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/utils.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 
 namespace onnxruntime {
 IOBinding::IOBinding(const SessionState& session_state) : session_state_(session_state) {
+  const int pool_capacity = std::atoi(session_state.GetSessionOptions().config_options
+                                          .GetConfigOrDefault(kOrtSessionOptionsIOBindingOutputPoolCapacity, "0")
+                                          .c_str());
+  if (pool_capacity > 0) {
+    SetOutputPoolCapacity(static_cast<size_t>(pool_capacity));
+  }
 }
 
 common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_value) {
@@ -110,6 +120,68 @@ void IOBinding::ClearOutputs() {
   outputs_device_info_.clear();
 }
 
+void IOBinding::SetOutputPoolCapacity(size_t buffers_per_output) {
+  std::lock_guard<std::mutex> lock(output_pool_mutex_);
+  output_pool_capacity_ = buffers_per_output;
+  if (output_pool_capacity_ == 0) {
+    output_pool_.clear();
+    return;
+  }
+
+  for (auto& [name, buffers] : output_pool_) {
+    if (buffers.size() > output_pool_capacity_) {
+      buffers.erase(buffers.begin(),
+                    buffers.begin() + static_cast<ptrdiff_t>(buffers.size() - output_pool_capacity_));
+    }
+  }
+}
+
+void IOBinding::RecycleOutputs() {
+  std::lock_guard<std::mutex> lock(output_pool_mutex_);
+  if (output_pool_capacity_ == 0) {
+    return;
+  }
+
+  for (size_t i = 0; i < output_names_.size(); ++i) {
+    OrtValue& value = outputs_[i];
+    if (!value.IsAllocated() || !value.IsTensor()) {
+      continue;
+    }
+
+    auto& buffers = output_pool_[output_names_[i]];
+    buffers.push_back(std::move(value));
+    if (buffers.size() > output_pool_capacity_) {
+      buffers.erase(buffers.begin());
+    }
+
+    // rebind by device so the next Run allocates (through the pool when shape/device match)
+    value = OrtValue{};
+  }
+}
+
+bool IOBinding::TakePooledOutput(const std::string& name, const TensorShape& shape,
+                                 const OrtDevice& device, OrtValue& value) {
+  std::lock_guard<std::mutex> lock(output_pool_mutex_);
+  auto pool_it = output_pool_.find(name);
+  if (pool_it == output_pool_.end()) {
+    return false;
+  }
+
+  auto& buffers = pool_it->second;
+  // newest first: it is the most likely to still be cache resident. The element type needs no
+  // check since all pooled buffers for a name were produced by the same model output.
+  for (auto it = buffers.rbegin(); it != buffers.rend(); ++it) {
+    const Tensor& tensor = it->Get<Tensor>();
+    if (tensor.Shape() == shape && tensor.Location().device == device) {
+      value = std::move(*it);
+      buffers.erase(std::next(it).base());
+      return true;
+    }
+  }
+
+  return false;
+}
+
 const std::vector<std::string>& IOBinding::GetOutputNames() const { return output_names_; }
 
 const std::vector<OrtValue>& IOBinding::GetOutputs() const { return outputs_; }
@@ -2,11 +2,13 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <mutex>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
 #include "core/framework/execution_provider.h"
+#include "core/framework/tensor.h"
 #include "core/common/status.h"
 #include "core/graph/basic_types.h"
 #include "core/framework/ort_value.h"
@@ -93,6 +95,33 @@ class IOBinding {
    */
   void ClearOutputs();
   void ClearInputs();
+
+  /**
+   * Enable a recycling pool for outputs: up to 'buffers_per_output' previously produced output
+   * buffers are retained per name (see RecycleOutputs). 0 (default) disables the pool and
+   * releases anything currently pooled. Initialized from the
+   * session.iobinding_output_pool_capacity session config entry.
+   */
+  void SetOutputPoolCapacity(size_t buffers_per_output);
+
+  bool OutputPoolEnabled() const { return output_pool_capacity_ > 0; }
+
+  /**
+   * Move the current outputs into the recycling pool and rebind each name by device. Driven by
+   * the run.recycle_iobinding_outputs run option: the caller thereby declares it is done
+   * reading the output tensors of the last Run, and buffers handed to the pool must no longer
+   * be read.
+   */
+  void RecycleOutputs();
+
+  /**
+   * Pop a pooled buffer for 'name' with exactly the given shape and device into 'value',
+   * skipping the per-Run allocation. Returns false on a pool miss (the caller allocates as
+   * usual). Used as the fetch allocator for device-bound outputs when the pool is enabled.
+   */
+  bool TakePooledOutput(const std::string& name, const TensorShape& shape, const OrtDevice& device,
+                        OrtValue& value);
+
   IOBinding(const SessionState& session_state);
 
  private:
@@ -107,6 +136,13 @@ class IOBinding {
   std::vector<OrtValue> outputs_;
   std::vector<OrtDevice> outputs_device_info_;
 
+  // output recycling pool: most recently recycled buffers per output name, newest last.
+  // TakePooledOutput runs as a fetch allocator on executor threads, which may produce
+  // different outputs concurrently, so pool access is serialized.
+  size_t output_pool_capacity_{0};
+  std::unordered_map<std::string, std::vector<OrtValue>> output_pool_;
+  std::mutex output_pool_mutex_;
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IOBinding);
 
   // device info for all outputs. only used by InferenceSession if the output is not pre-allocated.
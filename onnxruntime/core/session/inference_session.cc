@@ -28,7 +28,12 @@
 #include "core/framework/kernel_registry.h"
 #include "core/framework/kernel_type_str_resolver.h"
 #include "core/framework/kernel_type_str_resolver_utils.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
 #include "core/framework/mldata_type_utils.h"
+#include "core/framework/run_priority.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/tensor_type_and_shape.h"
@@ -1009,10 +1014,12 @@ common::Status InferenceSession::LoadOnnxModel(const PathString& model_uri) {
 
     const bool strict_shape_type_inference = session_options_.config_options.GetConfigOrDefault(
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
+    const bool trusted_model_load = session_options_.config_options.GetConfigOrDefault(
+                                        kOrtSessionOptionsTrustedModelLoad, "0") == "1";
     return onnxruntime::Model::Load(model_location_, model, HasLocalSchema() ? &custom_schema_registries_ : nullptr,
                                     *session_logger_,
                                     ModelOptions(true, strict_shape_type_inference,
-                                                 check_load_cancellation_fn_));
+                                                 check_load_cancellation_fn_, trusted_model_load));
   };
 
   common::Status st = LoadWithLoader(loader, "model_loading_uri");
@@ -1033,13 +1040,119 @@ common::Status InferenceSession::FilterEnabledOptimizers(InlinedHashSet<std::str
 }
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
+std::string InferenceSession::ComputeOptimizedModelCacheFingerprint(const PathString& model_uri) {
+  std::error_code ec;
+  const std::filesystem::path model_path{model_uri};
+  const auto file_size = std::filesystem::file_size(model_path, ec);
+  if (ec) {
+    return {};
+  }
+  const auto mtime = std::filesystem::last_write_time(model_path, ec);
+  if (ec) {
+    return {};
+  }
+
+  std::ostringstream fingerprint;
+  fingerprint << "size=" << file_size
+              << ";mtime=" << std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  mtime.time_since_epoch())
+                                  .count()
+              << ";ort_api_version=" << ORT_API_VERSION;
+  return fingerprint.str();
+}
+
+void InferenceSession::PublishOptimizedModelCache() {
+  if (optimized_model_cache_final_path_.empty()) {
+    return;
+  }
+
+  const std::filesystem::path tmp_path{session_options_.optimized_model_filepath};
+  const std::filesystem::path final_path{optimized_model_cache_final_path_};
+
+  std::error_code ec;
+  if (!std::filesystem::exists(tmp_path, ec)) {
+    return;  // saving was skipped (e.g. compiled nodes); nothing to publish
+  }
+
+  // fingerprint sidecar first (temp + rename), then the artifact itself, so a reader that sees
+  // the artifact always finds a sidecar to validate against
+  const std::filesystem::path fingerprint_path{optimized_model_cache_final_path_ +
+                                               ORT_TSTR(".fingerprint")};
+  std::filesystem::path fingerprint_tmp{fingerprint_path};
+  fingerprint_tmp += ".tmp";
+  {
+    std::ofstream out{fingerprint_tmp, std::ios::trunc};
+    if (!out.good()) {
+      LOGS(*session_logger_, WARNING) << "Failed to write optimized model cache fingerprint.";
+      return;
+    }
+    out << optimized_model_cache_fingerprint_ << "\n";
+  }
+  std::filesystem::rename(fingerprint_tmp, fingerprint_path, ec);
+  if (!ec) {
+    std::filesystem::rename(tmp_path, final_path, ec);
+  }
+  if (ec) {
+    LOGS(*session_logger_, WARNING) << "Failed to publish optimized model cache: " << ec.message();
+  }
+}
+
 common::Status InferenceSession::Load(const PathString& model_uri) {
   std::string model_type = session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigLoadModelFormat, "");
   bool has_explicit_type = !model_type.empty();
 
+  // Cross-process optimized-graph cache: when the cache file exists, load it instead of the
+  // original model with the graph transformers disabled (its optimizations are already baked
+  // in); when it doesn't, load the original and have Initialize() write the optimized model to
+  // the cache path via the existing optimized_model_filepath machinery. Later processes then
+  // skip the transformer passes entirely.
+  PathString actual_model_uri = model_uri;
+  const std::string optimized_cache =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsOptimizedModelCachePath, "");
+  if (!optimized_cache.empty()) {
+    const PathString cache_path = ToPathString(optimized_cache);
+    // Fingerprint of the original model plus the ORT version, stored in a sidecar next to the
+    // artifact. A content hash would force reading the full (multi-GB) model on every cache
+    // hit, defeating the cache, so size + mtime stand in for content; the ORT version catches
+    // upgrades that change the optimizers.
+    const std::string fingerprint = ComputeOptimizedModelCacheFingerprint(model_uri);
+    const PathString fingerprint_path = cache_path + ORT_TSTR(".fingerprint");
+
+    std::error_code ec;
+    bool cache_hit = false;
+    if (!fingerprint.empty() && std::filesystem::exists(std::filesystem::path{cache_path}, ec)) {
+      std::ifstream fingerprint_in{std::filesystem::path{fingerprint_path}};
+      std::string stored_fingerprint;
+      if (fingerprint_in.good()) {
+        std::getline(fingerprint_in, stored_fingerprint);
+      }
+      cache_hit = stored_fingerprint == fingerprint;
+      if (!cache_hit) {
+        LOGS(*session_logger_, INFO) << "Optimized model cache is stale (model or ORT version changed); rebuilding: "
+                                     << optimized_cache;
+      }
+    }
+
+    if (cache_hit) {
+      LOGS(*session_logger_, INFO) << "Loading optimized model from cache: " << optimized_cache;
+      session_options_.graph_optimization_level = TransformerLevel::Default;
+      actual_model_uri = cache_path;
+    } else if (!fingerprint.empty()) {
+      LOGS(*session_logger_, INFO) << "Optimized model cache miss; will write: " << optimized_cache;
+      // write to a temp file and publish (rename + fingerprint sidecar) only after Initialize
+      // succeeds, so another process's exists() check never observes a partial artifact
+      optimized_model_cache_final_path_ = cache_path;
+      optimized_model_cache_fingerprint_ = fingerprint;
+      // unique temp name so concurrent cold-starting processes never write the same file
+      session_options_.optimized_model_filepath =
+          cache_path + ORT_TSTR(".tmp.") +
+          ToPathString(std::to_string(reinterpret_cast<uintptr_t>(this)));
+    }
+  }
+
   if ((has_explicit_type && model_type == "ORT") ||
-      (!has_explicit_type && fbs::utils::IsOrtFormatModel(model_uri))) {
-    return LoadOrtModel(model_uri);
+      (!has_explicit_type && fbs::utils::IsOrtFormatModel(actual_model_uri))) {
+    return LoadOrtModel(actual_model_uri);
   }
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -1049,7 +1162,7 @@ common::Status InferenceSession::Load(const PathString& model_uri) {
                            "Invoke Load().");
   }
 
-  return LoadOnnxModel(model_uri);
+  return LoadOnnxModel(actual_model_uri);
 #else
   return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "ONNX format model is not supported in this build.");
 #endif
@@ -1096,6 +1209,8 @@ common::Status InferenceSession::Load(const void* model_data, int model_data_len
 
     const bool strict_shape_type_inference = session_options_.config_options.GetConfigOrDefault(
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
+    const bool trusted_model_load = session_options_.config_options.GetConfigOrDefault(
+                                        kOrtSessionOptionsTrustedModelLoad, "0") == "1";
 
     std::string external_data_folder_path = session_options_.config_options.GetConfigOrDefault(
         kOrtSessionOptionsModelExternalInitializersFileFolderPath, "");
@@ -1106,7 +1221,7 @@ common::Status InferenceSession::Load(const void* model_data, int model_data_len
     return onnxruntime::Model::Load(std::move(model_proto), model_location_, model,
                                     HasLocalSchema() ? &custom_schema_registries_ : nullptr, *session_logger_,
                                     ModelOptions(true, strict_shape_type_inference,
-                                                 check_load_cancellation_fn_));
+                                                 check_load_cancellation_fn_, trusted_model_load));
   };
 
   return LoadWithLoader(loader, "model_loading_array");
@@ -1134,6 +1249,8 @@ common::Status InferenceSession::LoadOnnxModel(ModelProto model_proto) {
 #endif
     const bool strict_shape_type_inference = session_options_.config_options.GetConfigOrDefault(
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
+    const bool trusted_model_load = session_options_.config_options.GetConfigOrDefault(
+                                        kOrtSessionOptionsTrustedModelLoad, "0") == "1";
 
     std::string external_data_folder_path = session_options_.config_options.GetConfigOrDefault(
         kOrtSessionOptionsModelExternalInitializersFileFolderPath, "");
@@ -1145,7 +1262,7 @@ common::Status InferenceSession::LoadOnnxModel(ModelProto model_proto) {
     return onnxruntime::Model::Load(std::move(model_proto), model_location_, model,
                                     HasLocalSchema() ? &custom_schema_registries_ : nullptr, *session_logger_,
                                     ModelOptions(true, strict_shape_type_inference,
-                                                 check_load_cancellation_fn_));
+                                                 check_load_cancellation_fn_, trusted_model_load));
   };
 
   return LoadWithLoader(loader, "model_loading_proto");
@@ -1177,6 +1294,8 @@ common::Status InferenceSession::Load(std::istream& model_istream, bool allow_re
 #endif
     const bool strict_shape_type_inference = session_options_.config_options.GetConfigOrDefault(
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
+    const bool trusted_model_load = session_options_.config_options.GetConfigOrDefault(
+                                        kOrtSessionOptionsTrustedModelLoad, "0") == "1";
     ModelOptions model_opts(allow_released_opsets_only,
                             strict_shape_type_inference,
                             check_load_cancellation_fn_);
@@ -1212,6 +1331,8 @@ common::Status InferenceSession::Load() {
 #endif
     const bool strict_shape_type_inference = session_options_.config_options.GetConfigOrDefault(
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
+    const bool trusted_model_load = session_options_.config_options.GetConfigOrDefault(
+                                        kOrtSessionOptionsTrustedModelLoad, "0") == "1";
     const bool allow_released_opsets_only = session_options_.config_options.GetConfigOrDefault(
                                                 kOrtSessionOptionsConfigStrictAllowReleasedOpsetsOnly, "1") == "1";
 
@@ -1219,7 +1340,7 @@ common::Status InferenceSession::Load() {
     return Model::Load(std::move(this->model_proto_), model_location_, model,
                        HasLocalSchema() ? &custom_schema_registries_ : nullptr, *session_logger_,
                        ModelOptions(allow_released_opsets_only, strict_shape_type_inference,
-                                    check_load_cancellation_fn_));
+                                    check_load_cancellation_fn_, trusted_model_load));
   };
 
   return LoadWithLoader(loader, "model_loading_from_saved_proto");
@@ -1242,6 +1363,8 @@ common::Status InferenceSession::Load(const OrtModel& model_editor_api_model) {
 
   const bool strict_shape_type_inference = session_options_.config_options.GetConfigOrDefault(
                                                kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
+  const bool trusted_model_load = session_options_.config_options.GetConfigOrDefault(
+                                      kOrtSessionOptionsTrustedModelLoad, "0") == "1";
 
   // need to go from unique_ptr to shared_ptr when moving into model_
   std::unique_ptr<Model> tmp_model;
@@ -1806,6 +1929,20 @@ common::Status InferenceSession::Initialize() {
     tp = session_profiler_.Start();
   }
 
+  // startup phase breakdown (see session.log_startup_phases): cumulative milestones logged at
+  // the major Initialize stages so fleet cold-start regressions localize to a phase
+  const bool log_startup_phases =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsLogStartupPhases, "0") == "1";
+  const auto initialize_start = std::chrono::steady_clock::now();
+  auto log_startup_phase = [&](const char* phase) {
+    if (log_startup_phases) {
+      const auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                  std::chrono::steady_clock::now() - initialize_start)
+                                  .count();
+      LOGS(*session_logger_, INFO) << "StartupPhase: " << phase << " done at +" << elapsed_ms << "ms";
+    }
+  };
+
   ORT_TRY {
     LOGS(*session_logger_, INFO) << "Initializing session.";
     const Env& env = Env::Default();
@@ -1891,6 +2028,22 @@ common::Status InferenceSession::Initialize() {
         session_options_,
         prepacked_weights_container_);
 
+    if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsCrossSessionInitializerSharing, "0") ==
+        "1") {
+      session_state_->SetSharedInitializerPool(&environment_.GetSharedInitializerPool());
+      LOGS(*session_logger_, INFO) << "Cross-session initializer sharing enabled.";
+    }
+
+    if (prepacked_weights_container_ != nullptr) {
+      const std::string prepacked_cache_dir =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsPrepackedWeightsCacheDir, "");
+      if (!prepacked_cache_dir.empty()) {
+        ORT_RETURN_IF_ERROR_SESSIONID_(
+            prepacked_weights_container_->SetDiskCacheDirectory(ToPathString(prepacked_cache_dir)));
+        LOGS(*session_logger_, INFO) << "Pre-packed weights disk cache enabled at: " << prepacked_cache_dir;
+      }
+    }
+
     bool use_env_allocators =
         session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseEnvAllocators, "0") == "1";
     if (use_env_allocators) {
@@ -2025,6 +2178,7 @@ common::Status InferenceSession::Initialize() {
 
       // now that all the transforms are done, call Resolve on the main graph. this will recurse into the subgraphs.
       ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+      log_startup_phase("graph_transforms_and_resolve");
       if (session_options_.IsLoadCancellationFlagSet()) {
         return ORT_MAKE_STATUS(ONNXRUNTIME, MODEL_LOAD_CANCELED,
                                "Session initialization canceled due to user request.");
@@ -2196,6 +2350,27 @@ common::Status InferenceSession::Initialize() {
                                              // need to keep the initializers if saving the optimized model
                                              !saving_model,
                                              saving_ort_format));
+    log_startup_phase("session_state_finalize");
+
+    // Kernel dispatch introspection: one line per node describing the kernel that was actually
+    // chosen, so deployments can diff placement/dispatch across builds or EP configurations
+    // without a debugger.
+    if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsLogKernelDispatch, "0") == "1") {
+      const auto& graph_viewer = session_state_->GetGraphViewer();
+      for (const auto& node : graph_viewer.Nodes()) {
+        const KernelCreateInfo& kci = session_state_->GetNodeKernelCreateInfo(node.Index());
+        const KernelDef& kernel_def = *kci.kernel_def;
+        const auto since_version = kernel_def.SinceVersion();
+        LOGS(*session_logger_, INFO) << "KernelDispatch: node=\"" << node.Name()
+                                     << "\" op=" << node.Domain() << (node.Domain().empty() ? "" : ".")
+                                     << node.OpType()
+                                     << " ep=" << node.GetExecutionProviderType()
+                                     << " kernel=" << kernel_def.Domain()
+                                     << (kernel_def.Domain().empty() ? "" : ".") << kernel_def.OpName()
+                                     << " since_version=[" << since_version.first << ","
+                                     << since_version.second << "]";
+      }
+    }
 
 #if !defined(ORT_MINIMAL_BUILD)
     if (saving_model) {
@@ -2250,6 +2425,8 @@ common::Status InferenceSession::Initialize() {
     ResolveMemoryPatternFlags(*session_state_);
 
     is_inited_ = true;
+    PublishOptimizedModelCache();
+    log_startup_phase("initialize_complete");
 
     if (!using_ort_model_bytes_for_initializers_) {
       ort_format_model_bytes_ = gsl::span<const uint8_t>();
@@ -2660,10 +2837,87 @@ Status InferenceSession::SetEpDynamicOptions(gsl::span<const char* const> keys,
   return retval;
 }
 
+Status InferenceSession::RefreshInitializers(
+    gsl::span<const std::pair<std::string, OrtValue>> initializers) {
+  std::lock_guard<std::mutex> l(session_mutex_);
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  for (const auto& [name, value] : initializers) {
+    ORT_RETURN_IF_ERROR(session_state_->RefreshInitializedTensor(name, value, kernel_registry_manager_));
+    LOGS(*session_logger_, INFO) << "Refreshed initializer: " << name;
+  }
+
+  return Status::OK();
+}
+
+Status InferenceSession::Warmup(gsl::span<const std::pair<std::string, TensorShape>> input_shapes) {
+  {
+    std::lock_guard<std::mutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  const auto& name_idx_map = session_state_->GetOrtValueNameIdxMap();
+
+  InlinedVector<int> feed_mlvalue_idxs;
+  feed_mlvalue_idxs.reserve(input_shapes.size());
+  std::vector<OrtValue> shape_only_feeds;
+  shape_only_feeds.reserve(input_shapes.size());
+
+  for (const auto& [name, shape] : input_shapes) {
+    int idx = -1;
+    ORT_RETURN_IF_ERROR(name_idx_map.GetIdx(name, idx));
+    feed_mlvalue_idxs.push_back(idx);
+
+    const auto* node_arg = model_->MainGraph().GetNodeArg(name);
+    ORT_RETURN_IF(node_arg == nullptr, "Unknown model input: ", name);
+
+    MLDataType ml_type = utils::GetMLDataType(*node_arg);
+    ORT_RETURN_IF(ml_type == nullptr || !ml_type->IsTensorType(),
+                  "Warmup only supports tensor inputs. Input: ", name);
+    const auto* element_type = static_cast<const TensorTypeBase*>(ml_type)->GetElementType();
+
+    // shape-only tensor: the planner reads shapes and never dereferences the (null) data.
+    Tensor shape_only(element_type, shape, nullptr,
+                      OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator));
+    OrtValue value;
+    Tensor::InitOrtValue(std::move(shape_only), value);
+    shape_only_feeds.push_back(std::move(value));
+  }
+
+  InlinedHashMap<OrtDevice, size_t> planned_peak_sizes;
+  ORT_RETURN_IF_ERROR(session_state_->PrimeMemoryPatterns(shape_only_feeds, feed_mlvalue_idxs,
+                                                          planned_peak_sizes));
+
+  // Grow each device arena to the planned steady state by taking and returning one peak-sized
+  // allocation; arena-based allocators retain the backing region for subsequent Runs.
+  for (const auto& [location, peak_size] : planned_peak_sizes) {
+    if (peak_size == 0) {
+      continue;
+    }
+    AllocatorPtr alloc = session_state_->GetAllocator(location);
+    if (alloc == nullptr) {
+      continue;
+    }
+    void* p = alloc->Alloc(peak_size);
+    alloc->Free(p);
+    LOGS(*session_logger_, INFO) << "Warmup grew allocator for " << location.ToString()
+                                 << " to peak of " << peak_size << " bytes.";
+  }
+
+  return Status::OK();
+}
+
 Status InferenceSession::Run(const RunOptions& run_options,
                              gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds,
                              gsl::span<const std::string> output_names, std::vector<OrtValue>* p_fetches,
-                             const std::vector<OrtDevice>* p_fetches_device_info) {
+                             const std::vector<OrtDevice>* p_fetches_device_info,
+                             const std::unordered_map<size_t, IExecutor::CustomAllocator>* fetch_allocators) {
   TimePoint tp;
   if (session_profiler_.IsEnabled()) {
     tp = session_profiler_.Start();
@@ -2789,14 +3043,21 @@ Status InferenceSession::Run(const RunOptions& run_options,
       DeviceStreamCollectionHolder device_stream_collection_holder(session_state_.get());
 #endif
 
+      // mark this thread with the run's priority; executors yield at node boundaries while a
+      // high-priority run is in flight (see run.priority)
+      RunPriorityScope run_priority_scope(RunPriorityScope::ParsePriority(
+          run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigRunPriority, "normal")));
+
       if (retval.IsOK()) {
+        static const std::unordered_map<size_t, IExecutor::CustomAllocator> no_fetch_allocators;
         retval = utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
                                      session_options_.execution_mode,
                                      run_options,
 #ifdef ORT_ENABLE_STREAM
                                      device_stream_collection_holder,
 #endif
-                                     run_logger);
+                                     run_logger,
+                                     fetch_allocators != nullptr ? *fetch_allocators : no_fetch_allocators);
       }
 
       // info all execution providers InferenceSession:Run ended
@@ -2961,9 +3222,24 @@ common::Status InferenceSession::RunAsync(const RunOptions* run_options,
                                           RunAsyncCallbackFn callback,
                                           void* user_data) {
   size_t num_fetches = fetch_names.size();
-  auto* tp = GetIntraOpThreadPoolToUse();
-  if (!tp || concurrency::ThreadPool::DegreeOfParallelism(tp) < 2) {
-    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "intra op thread pool must have at least one thread for RunAsync");
+  // Prefer the inter-op pool to host the run, keeping intra-op workers free for the kernels the
+  // run fans out - but only for sequential-execution sessions. In ORT_PARALLEL mode the
+  // executor schedules the run's own stream tasks onto the inter-op pool and then spins in
+  // WaitAll without executing queued work; hosting runs there too lets N >= pool-size
+  // concurrent RunAsync calls pin every worker in WaitAll with all stream tasks queued behind
+  // them - a permanent livelock. Parallel-mode sessions therefore host on the intra-op pool,
+  // as before.
+  concurrency::ThreadPool* tp = nullptr;
+  if (session_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL) {
+    tp = GetInterOpThreadPoolToUse();
+  }
+  if (!tp) {
+    tp = GetIntraOpThreadPoolToUse();
+    if (!tp || concurrency::ThreadPool::DegreeOfParallelism(tp) < 2) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "RunAsync requires an inter op thread pool (sequential execution), or an intra op "
+                             "thread pool with at least two threads");
+    }
   }
   std::function<void()> run_fn = [run_options, feed_names, feeds, fetch_names, fetches, num_fetches,
                                   callback, user_data, this]() {
@@ -3078,8 +3354,35 @@ common::Status InferenceSession::NewIOBinding(std::unique_ptr<IOBinding>* io_bin
 common::Status InferenceSession::Run(const RunOptions& run_options, IOBinding& io_binding) {
   // TODO should Run() call io_binding.SynchronizeInputs() or should it let the callers do it?
   // io_binding.SynchronizeInputs();
+
+  // With the output pool enabled (session.iobinding_output_pool_capacity), an opt-in run
+  // option moves the previous outputs into the pool - the caller thereby declares it is done
+  // reading them - and device-bound outputs are then allocated through the pool, reusing a
+  // retained buffer whenever the shape and device match.
+  std::unordered_map<size_t, IExecutor::CustomAllocator> fetch_allocators;
+  if (io_binding.OutputPoolEnabled()) {
+    if (run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigRecycleIOBindingOutputs, "0") == "1") {
+      io_binding.RecycleOutputs();
+    }
+
+    const auto& output_names = io_binding.GetOutputNames();
+    const auto& outputs = io_binding.GetOutputs();
+    for (size_t i = 0; i < output_names.size(); ++i) {
+      if (outputs[i].IsAllocated()) {
+        continue;  // pre-allocated by the caller; nothing to pool
+      }
+      fetch_allocators.emplace(
+          i, [&io_binding, name = output_names[i]](const TensorShape& shape, const OrtDevice& device,
+                                                   OrtValue& value, bool& allocated) {
+            allocated = io_binding.TakePooledOutput(name, shape, device, value);
+            return Status::OK();
+          });
+    }
+  }
+
   return Run(run_options, io_binding.GetInputNames(), io_binding.GetInputs(), io_binding.GetOutputNames(),
-             &io_binding.GetOutputs(), &io_binding.GetOutputsDeviceInfo());
+             &io_binding.GetOutputs(), &io_binding.GetOutputsDeviceInfo(),
+             fetch_allocators.empty() ? nullptr : &fetch_allocators);
 }
 
 common::Status InferenceSession::Run(IOBinding& io_binding) {
@@ -361,10 +361,36 @@ class InferenceSession {
   [[nodiscard]] common::Status SetEpDynamicOptions(gsl::span<const char* const> keys,
                                                    gsl::span<const char* const> values);
 
+  /**
+   * Warm the session for the given representative input shapes without executing the model.
+   * The memory pattern planner runs for those shapes and each device arena is grown to the
+   * planned steady-state peak, so the first real Run with matching shapes avoids pattern
+   * generation and arena extension. No input data is required and no outputs are produced.
+   * May be called multiple times with different shape sets.
+   * This method assumes the session has been initialized previously.
+   * @param input_shapes model input names with the representative shape to plan for.
+   * @return OK if success
+   */
+  [[nodiscard]] common::Status Warmup(gsl::span<const std::pair<std::string, TensorShape>> input_shapes);
+
+  /**
+   * Replace the contents of initializers in a fully initialized session without re-running the
+   * Initialize pipeline. The graph topology must be unchanged: each new value must match the
+   * existing initializer's type, shape and device. Kernels consuming a refreshed weight are
+   * re-created and re-prepacked; the execution plan, partitioning and memory patterns are left
+   * untouched. Intended for hot-reloading retrained weights.
+   * Must not be called concurrently with Run().
+   * @param initializers initializer names with their replacement values.
+   * @return OK if success
+   */
+  [[nodiscard]] common::Status RefreshInitializers(
+      gsl::span<const std::pair<std::string, OrtValue>> initializers);
+
   [[nodiscard]] common::Status Run(const RunOptions& run_options, gsl::span<const std::string> feed_names,
                                    gsl::span<const OrtValue> feeds, gsl::span<const std::string> output_names,
                                    std::vector<OrtValue>* p_fetches,
-                                   const std::vector<OrtDevice>* p_fetches_device_info = nullptr);
+                                   const std::vector<OrtDevice>* p_fetches_device_info = nullptr,
+                                   const std::unordered_map<size_t, IExecutor::CustomAllocator>* fetch_allocators = nullptr);
 
   [[nodiscard]] common::Status Run(const RunOptions& run_options,
                                    gsl::span<const char* const> feed_names,
@@ -869,6 +895,15 @@ class InferenceSession {
   // Number of concurrently running executors
   std::atomic<int> current_num_runs_ = 0;
 
+  // optimized-graph cache (session.optimized_model_cache_path): non-empty when Initialize
+  // should publish the optimized model written to the temp path (atomic rename + fingerprint
+  // sidecar). See Load/PublishOptimizedModelCache.
+  PathString optimized_model_cache_final_path_;
+  std::string optimized_model_cache_fingerprint_;
+
+  static std::string ComputeOptimizedModelCacheFingerprint(const PathString& model_uri);
+  void PublishOptimizedModelCache();
+
   mutable std::mutex session_mutex_;         // to ensure only one thread can invoke Load/Initialize
   bool is_model_loaded_ = false;             // GUARDED_BY(session_mutex_)
   bool is_inited_ = false;                   // GUARDED_BY(session_mutex_)
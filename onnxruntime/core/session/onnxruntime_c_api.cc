@@ -2253,6 +2253,14 @@ ORT_API_STATUS_IMPL(OrtApis::CreateArenaCfgV2, _In_reads_(num_keys) const char*
       cfg->initial_growth_chunk_size_bytes = static_cast<int>(arena_config_values[i]);
     } else if (strcmp(arena_config_keys[i], "max_power_of_two_extend_bytes") == 0) {
       cfg->max_power_of_two_extend_bytes = static_cast<int64_t>(arena_config_values[i]);
+    } else if (strcmp(arena_config_keys[i], "numa_interleave") == 0) {
+      cfg->numa_interleave = static_cast<int>(arena_config_values[i]);
+    } else if (strcmp(arena_config_keys[i], "auto_shrink_hysteresis_bytes") == 0) {
+      cfg->auto_shrink_hysteresis_bytes = static_cast<int64_t>(arena_config_values[i]);
+    } else if (strcmp(arena_config_keys[i], "thread_local_magazine_bytes") == 0) {
+      cfg->thread_local_magazine_bytes = static_cast<int64_t>(arena_config_values[i]);
+    } else if (strcmp(arena_config_keys[i], "use_huge_pages") == 0) {
+      cfg->use_huge_pages = static_cast<int>(arena_config_values[i]);
     } else {
       std::ostringstream oss;
       oss << "Invalid key found: " << arena_config_keys[i];
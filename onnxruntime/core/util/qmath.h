@@ -135,6 +135,30 @@ ParQuantizeLinearStd(const float* Input,
   });
 }
 
+/**
+ * @brief Run MlasQuantizeLinearRelu in parallel, with provided thread pool. Only 8-bit output
+ *        types have fused ReLU+quantize MLAS kernels.
+ */
+template <typename OutputType>
+void
+ParQuantizeLinearReluStd(const float* Input,
+                         OutputType* Output,
+                         size_t N,
+                         float Scale,
+                         OutputType ZeroPoint,
+                         concurrency::ThreadPool* thread_pool) {
+  static_assert(std::is_same<OutputType, int8_t>::value || std::is_same<OutputType, uint8_t>::value,
+                "fused ReLU+quantize is only available for int8/uint8 outputs");
+  constexpr std::ptrdiff_t block_size = 128;
+  const std::ptrdiff_t num_blocks = (N + block_size - 1) / block_size;
+  const TensorOpCost unit_cost{static_cast<double>(block_size * sizeof(float)), static_cast<double>(block_size * sizeof(uint8_t)), static_cast<double>(block_size) * 2.0};
+  concurrency::ThreadPool::TryParallelFor(thread_pool, num_blocks, unit_cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    auto begin_idx = begin * block_size;
+    auto end_idx = std::min(static_cast<std::ptrdiff_t>(N), end * block_size);
+    MlasQuantizeLinearRelu(&(Input[begin_idx]), &(Output[begin_idx]), end_idx - begin_idx, Scale, ZeroPoint);
+  });
+}
+
 /**
  * Defines a function for int4 quantization. Calls MLAS kernel in parallel with the provided thread pool.
  *
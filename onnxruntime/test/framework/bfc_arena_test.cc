@@ -481,5 +481,63 @@ TEST(BFCArenaTest, TestExtendStrategy) {
   ASSERT_EQ(extend_delta_bytes, extend_limit);
 }
 
+
+TEST(BFCArenaTest, AutoShrinkReleasesBalloonedRegions) {
+  // hysteresis of 1MB: a one-off large allocation should be released back once the decaying
+  // high-water mark falls below it
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30,
+             ArenaExtendStrategy::kSameAsRequested,
+             BFCArena::DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
+             BFCArena::DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
+             BFCArena::DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
+             BFCArena::DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES,
+             /*numa_interleave*/ false,
+             /*auto_shrink_hysteresis_bytes*/ 1 << 20);
+
+  void* balloon = a.Alloc(64 * 1024 * 1024);
+  a.Free(balloon);
+
+  AllocatorStats stats;
+  a.GetStats(&stats);
+  const int64_t ballooned_total = stats.total_allocated_bytes;
+  ASSERT_GE(ballooned_total, 64 * 1024 * 1024);
+
+  // steady-state small traffic: after enough frees the decayed high-water mark drops below
+  // the ballooned total and the free region is released
+  for (int i = 0; i < 64 * 1024; ++i) {
+    void* p = a.Alloc(256);
+    a.Free(p);
+  }
+
+  a.GetStats(&stats);
+  EXPECT_LT(stats.total_allocated_bytes, ballooned_total);
+}
+
+TEST(BFCArenaTest, MagazineServesRepeatAllocationsWithoutArenaBookkeeping) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30,
+             ArenaExtendStrategy::kNextPowerOfTwo,
+             BFCArena::DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
+             BFCArena::DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
+             BFCArena::DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
+             BFCArena::DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES,
+             /*numa_interleave*/ false,
+             /*auto_shrink_hysteresis_bytes*/ 0,
+             /*thread_local_magazine_bytes*/ 1 << 20);
+
+  void* p = a.Alloc(1024);
+  ASSERT_NE(p, nullptr);
+  a.Free(p);
+
+  // the block went to this thread's magazine: the chunk stays "in use" from the arena's view
+  AllocatorStats stats;
+  a.GetStats(&stats);
+  EXPECT_GT(stats.bytes_in_use, 0);
+
+  // a repeat allocation of the same rounded size is served straight from the magazine
+  void* again = a.Alloc(1024);
+  EXPECT_EQ(again, p);
+  a.Free(again);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
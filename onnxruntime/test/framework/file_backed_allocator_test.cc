@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/file_backed_allocator.h"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(FileBackedAllocatorTest, AllocWriteReadFree) {
+  FileBackedAllocator allocator;
+
+  constexpr size_t kBytes = 1 << 20;
+  void* p = allocator.Alloc(kBytes);
+  ASSERT_NE(p, nullptr);
+
+  // the mapping must be writable and hold data faithfully
+  auto* bytes = static_cast<uint8_t*>(p);
+  for (size_t i = 0; i < kBytes; i += 4096) {
+    bytes[i] = static_cast<uint8_t>(i >> 12);
+  }
+  for (size_t i = 0; i < kBytes; i += 4096) {
+    ASSERT_EQ(bytes[i], static_cast<uint8_t>(i >> 12)) << "offset " << i;
+  }
+
+  allocator.Free(p);
+}
+
+TEST(FileBackedAllocatorTest, ExplicitBackingDirectory) {
+  // the backing files are created (and immediately unlinked) in the configured directory
+  FileBackedAllocator allocator(".");
+
+  void* p = allocator.Alloc(4096);
+  ASSERT_NE(p, nullptr);
+  memset(p, 0x7e, 4096);
+  EXPECT_EQ(static_cast<uint8_t*>(p)[4095], 0x7e);
+  allocator.Free(p);
+}
+
+TEST(FileBackedAllocatorTest, ZeroSizeAndNullFree) {
+  FileBackedAllocator allocator;
+  EXPECT_EQ(allocator.Alloc(0), nullptr);
+  allocator.Free(nullptr);  // must be a no-op
+}
+
+TEST(FileBackedAllocatorTest, IndependentAllocations) {
+  FileBackedAllocator allocator;
+
+  void* a = allocator.Alloc(8192);
+  void* b = allocator.Alloc(8192);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  EXPECT_NE(a, b);
+
+  memset(a, 0x33, 8192);
+  memset(b, 0x44, 8192);
+  EXPECT_EQ(static_cast<uint8_t*>(a)[8191], 0x33);
+  EXPECT_EQ(static_cast<uint8_t*>(b)[8191], 0x44);
+
+  // free in either order
+  allocator.Free(b);
+  allocator.Free(a);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "asserts.h"
+#include "core/framework/tensor.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "test/framework/test_utils.h"
+#include "test/util/include/default_providers.h"
+#include "test/util/include/test_environment.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// A(1x2) x B(2x2) with B a constant initializer, so the CPU MatMul kernel pre-packs B.
+void CreateMatMulModelWithConstantB(std::unique_ptr<Model>& p_model,
+                                    const std::vector<float>& b_values) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 13;
+  p_model = std::make_unique<Model>("refresh_initializers_test", true, ModelMetaData(), PathString(),
+                                    IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                    std::vector<ONNX_NAMESPACE::FunctionProto>{},
+                                    DefaultLoggingManager().DefaultLogger(),
+                                    ModelOptions(true, true));
+  Graph& graph = p_model->MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto& input_arg_a = graph.GetOrCreateNodeArg("A", &tensor_float);
+  auto& input_arg_b = graph.GetOrCreateNodeArg("B", &tensor_float);
+  auto& output_arg = graph.GetOrCreateNodeArg("Y", &tensor_float);
+
+  TensorProto b_proto;
+  b_proto.set_name("B");
+  b_proto.set_data_type(TensorProto_DataType_FLOAT);
+  b_proto.add_dims(2);
+  b_proto.add_dims(2);
+  for (float v : b_values) {
+    b_proto.add_float_data(v);
+  }
+  graph.AddInitializedTensor(b_proto);
+
+  std::vector<NodeArg*> input_defs{&input_arg_a, &input_arg_b};
+  std::vector<NodeArg*> output_defs{&output_arg};
+  graph.AddNode("matmul", "MatMul", "MatMul with prepacked B", input_defs, output_defs);
+
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+void RunAndCheck(InferenceSession& session, const std::vector<float>& expected) {
+  OrtValue a_value;
+  const std::vector<int64_t> a_dims{1, 2};
+  const std::vector<float> a_values{1.0f, 2.0f};
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0],
+                       a_dims, a_values, &a_value);
+
+  NameMLValMap feeds;
+  feeds.insert(std::make_pair("A", a_value));
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+
+  ASSERT_STATUS_OK(session.Run(feeds, output_names, &fetches));
+  ASSERT_EQ(fetches.size(), 1u);
+  const Tensor& y = fetches[0].Get<Tensor>();
+  ASSERT_EQ(y.Shape(), TensorShape({1, 2}));
+  auto y_span = y.DataAsSpan<float>();
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(y_span[i], expected[i]) << "output " << i;
+  }
+}
+
+}  // namespace
+
+// Refreshing a pre-packed weight must leave the session runnable with the new values: the
+// consumer kernel is rebuilt and re-packs (keeping its packed copy per the non-sharing
+// PrePack contract), and subsequent Runs use the refreshed weight.
+TEST(RefreshInitializersTest, RunAfterRefreshUsesNewWeights) {
+  std::unique_ptr<Model> model;
+  CreateMatMulModelWithConstantB(model, {1.0f, 0.0f, 0.0f, 1.0f});  // identity
+
+  std::stringstream model_stream;
+  ASSERT_TRUE(model->ToProto().SerializeToOstream(&model_stream));
+
+  SessionOptions so;
+  so.session_logid = "RefreshInitializersTest";
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  // A x I == A
+  RunAndCheck(session, {1.0f, 2.0f});
+
+  // refresh B to 2*I and run again; the rebuilt kernel must compute with the new values
+  OrtValue new_b;
+  const std::vector<int64_t> b_dims{2, 2};
+  const std::vector<float> new_b_values{2.0f, 0.0f, 0.0f, 2.0f};
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0],
+                       b_dims, new_b_values, &new_b);
+  const std::pair<std::string, OrtValue> refresh_entry{"B", new_b};
+  ASSERT_STATUS_OK(session.RefreshInitializers(gsl::make_span(&refresh_entry, 1)));
+
+  RunAndCheck(session, {2.0f, 4.0f});
+
+  // a second refresh exercises the released-after-prepack path again
+  OrtValue third_b;
+  const std::vector<float> third_b_values{0.0f, 1.0f, 1.0f, 0.0f};
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0],
+                       b_dims, third_b_values, &third_b);
+  const std::pair<std::string, OrtValue> second_refresh{"B", third_b};
+  ASSERT_STATUS_OK(session.RefreshInitializers(gsl::make_span(&second_refresh, 1)));
+
+  RunAndCheck(session, {2.0f, 1.0f});
+}
+
+// Mismatched shapes must be rejected without touching session state.
+TEST(RefreshInitializersTest, ShapeMismatchRejected) {
+  std::unique_ptr<Model> model;
+  CreateMatMulModelWithConstantB(model, {1.0f, 0.0f, 0.0f, 1.0f});
+
+  std::stringstream model_stream;
+  ASSERT_TRUE(model->ToProto().SerializeToOstream(&model_stream));
+
+  SessionOptions so;
+  so.session_logid = "RefreshInitializersTest";
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  OrtValue wrong_shape_b;
+  const std::vector<int64_t> wrong_dims{2, 3};
+  const std::vector<float> wrong_values{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0],
+                       wrong_dims, wrong_values, &wrong_shape_b);
+  const std::pair<std::string, OrtValue> refresh_entry{"B", wrong_shape_b};
+  EXPECT_FALSE(session.RefreshInitializers(gsl::make_span(&refresh_entry, 1)).IsOK());
+
+  // session still runs with the original weights
+  RunAndCheck(session, {1.0f, 2.0f});
+}
+
+}  // namespace test
+}  // namespace onnxruntime
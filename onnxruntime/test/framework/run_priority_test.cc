@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/run_priority.h"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(RunPriorityTest, ParsePriority) {
+  EXPECT_EQ(RunPriorityScope::ParsePriority("high"), RunPriorityScope::Priority::kHigh);
+  EXPECT_EQ(RunPriorityScope::ParsePriority("low"), RunPriorityScope::Priority::kLow);
+  EXPECT_EQ(RunPriorityScope::ParsePriority("normal"), RunPriorityScope::Priority::kNormal);
+  EXPECT_EQ(RunPriorityScope::ParsePriority("bogus"), RunPriorityScope::Priority::kNormal);
+  EXPECT_EQ(RunPriorityScope::ParsePriority(""), RunPriorityScope::Priority::kNormal);
+}
+
+TEST(RunPriorityTest, LowYieldsOnlyWhileHighActive) {
+  // no high-priority run: a low-priority thread does not yield
+  {
+    RunPriorityScope low(RunPriorityScope::Priority::kLow);
+    EXPECT_FALSE(RunPriorityScope::ShouldYieldToHigherPriority());
+  }
+
+  // high run active on another thread: the low-priority thread yields, normal threads don't
+  {
+    RunPriorityScope high(RunPriorityScope::Priority::kHigh);
+
+    std::thread low_thread([]() {
+      RunPriorityScope low(RunPriorityScope::Priority::kLow);
+      EXPECT_TRUE(RunPriorityScope::ShouldYieldToHigherPriority());
+    });
+    low_thread.join();
+
+    std::thread normal_thread([]() {
+      EXPECT_FALSE(RunPriorityScope::ShouldYieldToHigherPriority());
+    });
+    normal_thread.join();
+  }
+
+  // high run finished: the gate clears
+  std::thread low_after([]() {
+    RunPriorityScope low(RunPriorityScope::Priority::kLow);
+    EXPECT_FALSE(RunPriorityScope::ShouldYieldToHigherPriority());
+  });
+  low_after.join();
+}
+
+TEST(RunPriorityTest, ScopesNestAndRestore) {
+  RunPriorityScope low(RunPriorityScope::Priority::kLow);
+  {
+    RunPriorityScope high(RunPriorityScope::Priority::kHigh);
+    // this thread is now the high run itself; it must not yield to itself
+    EXPECT_FALSE(RunPriorityScope::ShouldYieldToHigherPriority());
+  }
+  // inner scope restored the thread's low priority; no high run remains
+  EXPECT_FALSE(RunPriorityScope::ShouldYieldToHigherPriority());
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,266 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Session-level coverage for the config-driven startup/execution features: each test runs a
+// real session with the feature enabled and verifies outputs match the plain configuration,
+// so the options cannot silently corrupt execution.
+
+#include <array>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "asserts.h"
+#include "core/framework/tensor.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "core/session/onnxruntime_run_options_config_keys.h"
+#include "test/framework/test_utils.h"
+#include "test/util/include/default_providers.h"
+#include "test/util/include/test_environment.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// A([M,2], M symbolic) x B(2x2 constant initializer) -> Y. The symbolic M exercises the
+// dynamic-shape paths (bucketed patterns); the constant B exercises prepacking.
+void CreateDynamicMatMulModel(std::unique_ptr<Model>& p_model) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 13;
+  p_model = std::make_unique<Model>("session_config_features_test", true, ModelMetaData(),
+                                    PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                                    domain_to_version,
+                                    std::vector<ONNX_NAMESPACE::FunctionProto>{},
+                                    DefaultLoggingManager().DefaultLogger(),
+                                    ModelOptions(true, true));
+  Graph& graph = p_model->MainGraph();
+
+  TypeProto dynamic_float;
+  dynamic_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  dynamic_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("M");
+  dynamic_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto& input_arg_a = graph.GetOrCreateNodeArg("A", &dynamic_float);
+  auto& input_arg_b = graph.GetOrCreateNodeArg("B", &tensor_float);
+  auto& output_arg = graph.GetOrCreateNodeArg("Y", &tensor_float);
+
+  TensorProto b_proto;
+  b_proto.set_name("B");
+  b_proto.set_data_type(TensorProto_DataType_FLOAT);
+  b_proto.add_dims(2);
+  b_proto.add_dims(2);
+  for (float v : {1.0f, 2.0f, 3.0f, 4.0f}) {
+    b_proto.add_float_data(v);
+  }
+  graph.AddInitializedTensor(b_proto);
+
+  std::vector<NodeArg*> input_defs{&input_arg_a, &input_arg_b};
+  std::vector<NodeArg*> output_defs{&output_arg};
+  graph.AddNode("matmul", "MatMul", "MatMul", input_defs, output_defs);
+
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+void SerializeModel(Model& model, std::stringstream& stream) {
+  ASSERT_TRUE(model.ToProto().SerializeToOstream(&stream));
+}
+
+// runs A of shape [rows, 2] with values 1..rows*2 and checks Y == A x [[1,2],[3,4]]
+void RunAndCheck(InferenceSession& session, int64_t rows,
+                 const RunOptions* run_options = nullptr) {
+  std::vector<int64_t> a_dims{rows, 2};
+  std::vector<float> a_values;
+  for (int64_t i = 0; i < rows * 2; ++i) {
+    a_values.push_back(static_cast<float>(i + 1));
+  }
+
+  OrtValue a_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0],
+                       a_dims, a_values, &a_value);
+
+  NameMLValMap feeds;
+  feeds.insert(std::make_pair("A", a_value));
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+
+  if (run_options != nullptr) {
+    ASSERT_STATUS_OK(session.Run(*run_options, feeds, output_names, &fetches));
+  } else {
+    ASSERT_STATUS_OK(session.Run(feeds, output_names, &fetches));
+  }
+
+  const Tensor& y = fetches[0].Get<Tensor>();
+  ASSERT_EQ(y.Shape(), TensorShape({rows, 2}));
+  auto y_span = y.DataAsSpan<float>();
+  for (int64_t r = 0; r < rows; ++r) {
+    const float a0 = a_values[static_cast<size_t>(r) * 2];
+    const float a1 = a_values[static_cast<size_t>(r) * 2 + 1];
+    EXPECT_FLOAT_EQ(y_span[r * 2], a0 * 1.0f + a1 * 3.0f) << "row " << r;
+    EXPECT_FLOAT_EQ(y_span[r * 2 + 1], a0 * 2.0f + a1 * 4.0f) << "row " << r;
+  }
+}
+
+void LoadInitializeAndCheck(const SessionOptions& so, int64_t rows_first, int64_t rows_second) {
+  std::unique_ptr<Model> model;
+  CreateDynamicMatMulModel(model);
+  std::stringstream model_stream;
+  SerializeModel(*model, model_stream);
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  RunAndCheck(session, rows_first);
+  RunAndCheck(session, rows_second);
+}
+
+SessionOptions BaseOptions(const char* logid) {
+  SessionOptions so;
+  so.session_logid = logid;
+  return so;
+}
+
+}  // namespace
+
+TEST(SessionConfigFeaturesTest, ParallelInitializeProducesWorkingSession) {
+  SessionOptions so = BaseOptions("ParallelInitialize");
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsParallelInitializeDegree, "4"));
+  LoadInitializeAndCheck(so, 1, 3);
+}
+
+TEST(SessionConfigFeaturesTest, TrustedModelLoadRuns) {
+  SessionOptions so = BaseOptions("TrustedLoad");
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsTrustedModelLoad, "1"));
+  LoadInitializeAndCheck(so, 2, 5);
+}
+
+TEST(SessionConfigFeaturesTest, ShapeBucketedPatternsProduceCorrectOutputs) {
+  SessionOptions so = BaseOptions("BucketedPatterns");
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMemoryPatternShapeBucketSize, "32"));
+  // two shapes in the same bucket plus one in the next: all must compute correctly even
+  // though the pattern blocks are sized for the bucket ceiling
+  std::unique_ptr<Model> model;
+  CreateDynamicMatMulModel(model);
+  std::stringstream model_stream;
+  SerializeModel(*model, model_stream);
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  RunAndCheck(session, 3);
+  RunAndCheck(session, 17);
+  RunAndCheck(session, 40);
+}
+
+TEST(SessionConfigFeaturesTest, WarmupThenRunMatches) {
+  SessionOptions so = BaseOptions("Warmup");
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsMemoryPatternShapeBucketSize, "32"));
+
+  std::unique_ptr<Model> model;
+  CreateDynamicMatMulModel(model);
+  std::stringstream model_stream;
+  SerializeModel(*model, model_stream);
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  // warm for a representative shape (no data), then run with a shape in the same bucket
+  const std::pair<std::string, TensorShape> warm_shape{"A", TensorShape({16, 2})};
+  ASSERT_STATUS_OK(session.Warmup(gsl::make_span(&warm_shape, 1)));
+
+  RunAndCheck(session, 16);
+  RunAndCheck(session, 7);
+}
+
+TEST(SessionConfigFeaturesTest, AdaptiveIntraOpThresholdRuns) {
+  SessionOptions so = BaseOptions("AdaptiveIntraOp");
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsAdaptiveIntraOpThresholdUs, "1000"));
+
+  std::unique_ptr<Model> model;
+  CreateDynamicMatMulModel(model);
+  std::stringstream model_stream;
+  SerializeModel(*model, model_stream);
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  // several runs so the per-node EMA demotes the tiny MatMul to single threaded; outputs must
+  // stay correct throughout the transition
+  for (int i = 0; i < 8; ++i) {
+    RunAndCheck(session, 2);
+  }
+}
+
+TEST(SessionConfigFeaturesTest, NodeDurationHistogramsCountExecutions) {
+  SessionOptions so = BaseOptions("DurationHistograms");
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsCollectNodeDurationHistograms, "1"));
+
+  std::unique_ptr<Model> model;
+  CreateDynamicMatMulModel(model);
+  std::stringstream model_stream;
+  SerializeModel(*model, model_stream);
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  constexpr int kRuns = 5;
+  for (int i = 0; i < kRuns; ++i) {
+    RunAndCheck(session, 2);
+  }
+
+  // every kernel execution lands in exactly one bucket, so the counts across all nodes sum
+  // to kRuns * <number of executed nodes> (one MatMul here)
+  const SessionState& session_state = session.GetSessionState();
+  ASSERT_TRUE(session_state.NodeDurationHistogramsEnabled());
+
+  uint64_t total = 0;
+  bool any_node = false;
+  std::array<uint64_t, SessionState::kNodeDurationHistogramBuckets> buckets{};
+  for (NodeIndex node_index = 0;; ++node_index) {
+    if (!session_state.GetNodeDurationHistogram(node_index, buckets)) {
+      break;
+    }
+    any_node = true;
+    for (uint64_t count : buckets) {
+      total += count;
+    }
+  }
+  ASSERT_TRUE(any_node);
+  EXPECT_EQ(total, static_cast<uint64_t>(kRuns));
+}
+
+TEST(SessionConfigFeaturesTest, RunPriorityOptionsExecute) {
+  SessionOptions so = BaseOptions("RunPriority");
+
+  std::unique_ptr<Model> model;
+  CreateDynamicMatMulModel(model);
+  std::stringstream model_stream;
+  SerializeModel(*model, model_stream);
+
+  InferenceSession session{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  RunOptions high;
+  ASSERT_STATUS_OK(high.config_options.AddConfigEntry(kOrtRunOptionsConfigRunPriority, "high"));
+  RunAndCheck(session, 2, &high);
+
+  RunOptions low;
+  ASSERT_STATUS_OK(low.config_options.AddConfigEntry(kOrtRunOptionsConfigRunPriority, "low"));
+  RunAndCheck(session, 2, &low);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
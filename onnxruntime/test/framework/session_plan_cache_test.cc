@@ -0,0 +1,234 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/session_plan_cache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "asserts.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "test/framework/test_utils.h"
+#include "test/util/include/default_providers.h"
+#include "test/util/include/test_environment.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// Removes the file (if present) when the test scope exits.
+struct ScopedFileDeleter {
+  explicit ScopedFileDeleter(PathString path) : path_(std::move(path)) {}
+  ~ScopedFileDeleter() {
+    std::error_code ec;
+    std::filesystem::remove(std::filesystem::path{path_}, ec);
+  }
+  PathString path_;
+};
+
+SequentialExecutionPlan MakeTestPlan() {
+  SequentialExecutionPlan plan;
+  plan.allocation_plan.resize(4);
+  plan.allocation_plan[0].alloc_kind = AllocKind::kAllocate;
+  plan.allocation_plan[1].alloc_kind = AllocKind::kReuse;
+  plan.allocation_plan[1].reused_buffer = 0;
+  plan.allocation_plan[2].alloc_kind = AllocKind::kAllocateStatically;
+  plan.allocation_plan[3].alloc_kind = AllocKind::kAllocateOutput;
+  return plan;
+}
+
+}  // namespace
+
+TEST(SessionPlanCacheTest, SaveLoadRoundTrip) {
+  const PathString path = ORT_TSTR("session_plan_cache_test_roundtrip.bin");
+  ScopedFileDeleter cleanup{path};
+
+  SequentialExecutionPlan plan = MakeTestPlan();
+  constexpr uint64_t model_hash = 0xfeedf00dcafebeef;
+  ASSERT_TRUE(SessionPlanCache::Save(path, model_hash, plan).IsOK());
+
+  CachedReusePlan cached;
+  ASSERT_TRUE(SessionPlanCache::Load(path, model_hash, cached).IsOK());
+  ASSERT_EQ(cached.values.size(), plan.allocation_plan.size());
+  EXPECT_EQ(cached.model_hash, model_hash);
+  for (size_t i = 0; i < cached.values.size(); ++i) {
+    EXPECT_EQ(cached.values[i].alloc_kind, plan.allocation_plan[i].alloc_kind);
+    EXPECT_EQ(cached.values[i].reused_buffer, plan.allocation_plan[i].reused_buffer);
+  }
+}
+
+TEST(SessionPlanCacheTest, HashMismatchIsAMiss) {
+  const PathString path = ORT_TSTR("session_plan_cache_test_mismatch.bin");
+  ScopedFileDeleter cleanup{path};
+
+  ASSERT_TRUE(SessionPlanCache::Save(path, /*model_hash*/ 1, MakeTestPlan()).IsOK());
+
+  CachedReusePlan cached;
+  ASSERT_TRUE(SessionPlanCache::Load(path, /*expected_model_hash*/ 2, cached).IsOK());
+  EXPECT_TRUE(cached.Empty());
+}
+
+TEST(SessionPlanCacheTest, MissingFileIsAMiss) {
+  CachedReusePlan cached;
+  ASSERT_TRUE(SessionPlanCache::Load(ORT_TSTR("nonexistent_plan_cache_file.bin"), 1, cached).IsOK());
+  EXPECT_TRUE(cached.Empty());
+}
+
+TEST(SessionPlanCacheTest, OutOfRangeAllocKindFailsLoad) {
+  const PathString path = ORT_TSTR("session_plan_cache_test_bad_kind.bin");
+  ScopedFileDeleter cleanup{path};
+
+  constexpr uint64_t model_hash = 42;
+
+  // valid header for one value, followed by an alloc kind outside the enum range
+  {
+    std::ofstream out{std::filesystem::path{path}, std::ios::binary};
+    const uint32_t magic = 0x5452'4f50;  // 'PORT'
+    const uint32_t version = 1;
+    const uint64_t num_values = 1;
+    out.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+    out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    out.write(reinterpret_cast<const char*>(&model_hash), sizeof(model_hash));
+    out.write(reinterpret_cast<const char*>(&num_values), sizeof(num_values));
+    const int32_t bad_alloc_kind = 42;
+    const int32_t reused_buffer = 0;
+    out.write(reinterpret_cast<const char*>(&bad_alloc_kind), sizeof(bad_alloc_kind));
+    out.write(reinterpret_cast<const char*>(&reused_buffer), sizeof(reused_buffer));
+  }
+
+  CachedReusePlan cached;
+  EXPECT_FALSE(SessionPlanCache::Load(path, model_hash, cached).IsOK());
+}
+
+TEST(SessionPlanCacheTest, CorruptFileFailsLoad) {
+  const PathString path = ORT_TSTR("session_plan_cache_test_corrupt.bin");
+  ScopedFileDeleter cleanup{path};
+
+  {
+    std::ofstream out{std::filesystem::path{path}, std::ios::binary};
+    out << "not a plan cache";
+  }
+
+  CachedReusePlan cached;
+  EXPECT_FALSE(SessionPlanCache::Load(path, 1, cached).IsOK());
+}
+
+namespace {
+
+// Add(A, Relu(A x B)) with B a constant initializer: the Relu output is an activation whose
+// allocation decision (and value_type) must survive the cache replay.
+void CreateChainedModelStream(std::stringstream& model_stream) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 13;
+  Model model("session_plan_cache_e2e_test", true, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+              std::vector<ONNX_NAMESPACE::FunctionProto>{},
+              DefaultLoggingManager().DefaultLogger(),
+              ModelOptions(true, true));
+  Graph& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto& input_arg_a = graph.GetOrCreateNodeArg("A", &tensor_float);
+  auto& input_arg_b = graph.GetOrCreateNodeArg("B", &tensor_float);
+  auto& matmul_out = graph.GetOrCreateNodeArg("matmul_out", &tensor_float);
+  auto& relu_out = graph.GetOrCreateNodeArg("relu_out", &tensor_float);
+  auto& output_arg = graph.GetOrCreateNodeArg("Y", &tensor_float);
+
+  TensorProto b_proto;
+  b_proto.set_name("B");
+  b_proto.set_data_type(TensorProto_DataType_FLOAT);
+  b_proto.add_dims(2);
+  b_proto.add_dims(2);
+  for (float v : {1.0f, -2.0f, 3.0f, 4.0f}) {
+    b_proto.add_float_data(v);
+  }
+  graph.AddInitializedTensor(b_proto);
+
+  {
+    std::vector<NodeArg*> input_defs{&input_arg_a, &input_arg_b};
+    std::vector<NodeArg*> output_defs{&matmul_out};
+    graph.AddNode("matmul", "MatMul", "MatMul", input_defs, output_defs);
+  }
+  {
+    std::vector<NodeArg*> input_defs{&matmul_out};
+    std::vector<NodeArg*> output_defs{&relu_out};
+    graph.AddNode("relu", "Relu", "Relu", input_defs, output_defs);
+  }
+  {
+    std::vector<NodeArg*> input_defs{&input_arg_a, &relu_out};
+    std::vector<NodeArg*> output_defs{&output_arg};
+    graph.AddNode("add", "Add", "Add", input_defs, output_defs);
+  }
+
+  ASSERT_STATUS_OK(graph.Resolve());
+  ASSERT_TRUE(model.ToProto().SerializeToOstream(&model_stream));
+}
+
+void RunChainedModelAndCheck(InferenceSession& session) {
+  OrtValue a_value;
+  const std::vector<int64_t> a_dims{1, 2};
+  const std::vector<float> a_values{1.0f, 2.0f};
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0],
+                       a_dims, a_values, &a_value);
+
+  NameMLValMap feeds;
+  feeds.insert(std::make_pair("A", a_value));
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session.Run(feeds, output_names, &fetches));
+
+  // A x B = [7, 6]; Relu keeps both; Y = A + [7, 6] = [8, 8]
+  const Tensor& y = fetches[0].Get<Tensor>();
+  ASSERT_EQ(y.Shape(), TensorShape({1, 2}));
+  auto y_span = y.DataAsSpan<float>();
+  EXPECT_FLOAT_EQ(y_span[0], 8.0f);
+  EXPECT_FLOAT_EQ(y_span[1], 8.0f);
+}
+
+}  // namespace
+
+// End to end: the first session populates the cache, the second replays it. The replayed
+// plan must leave the session fully runnable (activation types, reuse decisions).
+TEST(SessionPlanCacheTest, CacheHitSessionRuns) {
+  const PathString cache_path = ORT_TSTR("session_plan_cache_test_e2e.bin");
+  ScopedFileDeleter cleanup{cache_path};
+
+  SessionOptions so;
+  so.session_logid = "SessionPlanCacheTest";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsExecutionPlanCachePath,
+                                                    ToUTF8String(cache_path).c_str()));
+
+  {
+    std::stringstream model_stream;
+    CreateChainedModelStream(model_stream);
+    InferenceSession session{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session.Load(model_stream));
+    ASSERT_STATUS_OK(session.Initialize());
+    RunChainedModelAndCheck(session);
+  }
+
+  // artifact was written by the first session
+  ASSERT_TRUE(std::filesystem::exists(std::filesystem::path{cache_path}));
+
+  {
+    std::stringstream model_stream;
+    CreateChainedModelStream(model_stream);
+    InferenceSession session{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session.Load(model_stream));
+    ASSERT_STATUS_OK(session.Initialize());  // cache hit: reuse decisions replayed
+    RunChainedModelAndCheck(session);
+  }
+}
+
+}  // namespace test
+}  // namespace onnxruntime
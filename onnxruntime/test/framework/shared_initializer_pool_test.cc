@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/shared_initializer_pool.h"
+
+#include "gtest/gtest.h"
+
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+OrtValue MakeCpuTensor(const std::vector<int64_t>& dims, const std::vector<float>& values) {
+  auto allocator = std::make_shared<CPUAllocator>();
+  OrtValue value;
+  Tensor::InitOrtValue(DataTypeImpl::GetType<float>(), TensorShape(dims), allocator, value);
+  float* data = value.GetMutable<Tensor>()->MutableData<float>();
+  std::copy(values.begin(), values.end(), data);
+  return value;
+}
+
+}  // namespace
+
+TEST(SharedInitializerPoolTest, IdenticalContentShares) {
+  SharedInitializerPool pool;
+
+  OrtValue first = MakeCpuTensor({2, 2}, {1.f, 2.f, 3.f, 4.f});
+  OrtValue canonical = pool.GetOrAdd(first);
+  EXPECT_EQ(canonical.Get<Tensor>().DataRaw(), first.Get<Tensor>().DataRaw());
+  EXPECT_EQ(pool.Size(), 1u);
+
+  // a byte-identical tensor from "another session" resolves to the canonical buffer
+  OrtValue second = MakeCpuTensor({2, 2}, {1.f, 2.f, 3.f, 4.f});
+  OrtValue shared = pool.GetOrAdd(second);
+  EXPECT_EQ(shared.Get<Tensor>().DataRaw(), first.Get<Tensor>().DataRaw());
+  EXPECT_EQ(pool.Size(), 1u);
+}
+
+TEST(SharedInitializerPoolTest, LookupSkipsDeserialization) {
+  SharedInitializerPool pool;
+
+  const std::vector<float> values{5.f, 6.f, 7.f, 8.f};
+  OrtValue canonical = pool.GetOrAdd(MakeCpuTensor({4}, values));
+
+  OrtValue out;
+  ASSERT_TRUE(pool.Lookup(values.data(), values.size() * sizeof(float),
+                          DataTypeImpl::GetType<float>(), TensorShape({4}), out));
+  EXPECT_EQ(out.Get<Tensor>().DataRaw(), canonical.Get<Tensor>().DataRaw());
+
+  // same bytes, different shape: no hit - the aliased tensor's shape is what kernels see
+  OrtValue mismatch;
+  EXPECT_FALSE(pool.Lookup(values.data(), values.size() * sizeof(float),
+                           DataTypeImpl::GetType<float>(), TensorShape({2, 2}), mismatch));
+
+  // different bytes: no hit
+  const std::vector<float> other{5.f, 6.f, 7.f, 9.f};
+  EXPECT_FALSE(pool.Lookup(other.data(), other.size() * sizeof(float),
+                           DataTypeImpl::GetType<float>(), TensorShape({4}), mismatch));
+}
+
+TEST(SharedInitializerPoolTest, DifferentContentDoesNotShare) {
+  SharedInitializerPool pool;
+
+  OrtValue a = pool.GetOrAdd(MakeCpuTensor({2}, {1.f, 2.f}));
+  OrtValue b = pool.GetOrAdd(MakeCpuTensor({2}, {3.f, 4.f}));
+  EXPECT_NE(a.Get<Tensor>().DataRaw(), b.Get<Tensor>().DataRaw());
+  EXPECT_EQ(pool.Size(), 2u);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "mlas.h"
+#include "bench_util.h"
+#include "core/util/thread_utils.h"
+
+#include <memory>
+#include <stdexcept>
+
+// SGEMM benchmark reporting the inputs a roofline plot needs alongside wall time: achieved
+// GFLOP/s, the bytes each iteration must move, and the resulting arithmetic intensity
+// (flop/byte). Comparing the reported GFLOP/s against the machine's peak at the printed
+// intensity shows directly whether a shape is compute or bandwidth bound.
+
+static const std::vector<std::string> sgemm_roofline_arg_names = {"M", "N", "K", "Threads"};
+
+static void SGEMM_ROOFLINE(benchmark::State& state) {
+  if (state.range(0) <= 0) throw std::invalid_argument("M must greater than 0!");
+  if (state.range(1) <= 0) throw std::invalid_argument("N must greater than 0!");
+  if (state.range(2) <= 0) throw std::invalid_argument("K must greater than 0!");
+  if (state.range(3) <= 0) throw std::invalid_argument("Threads must greater than 0!");
+
+  const size_t M = static_cast<size_t>(state.range(0));
+  const size_t N = static_cast<size_t>(state.range(1));
+  const size_t K = static_cast<size_t>(state.range(2));
+  const size_t threads = static_cast<size_t>(state.range(3));
+
+  OrtThreadPoolParams tpo;
+  tpo.thread_pool_size = int(threads);
+  tpo.auto_set_affinity = true;
+  std::unique_ptr<onnxruntime::concurrency::ThreadPool> tp(
+      onnxruntime::concurrency::CreateThreadPool(&onnxruntime::Env::Default(),
+                                                 tpo, onnxruntime::concurrency::ThreadPoolType::INTRA_OP));
+
+  auto A_holder = RandomVectorUniform<float>(M * K, -1.0f, 1.0f);
+  auto B_holder = RandomVectorUniform<float>(K * N, -1.0f, 1.0f);
+  std::vector<float> C_holder(M * N);
+
+  MLAS_SGEMM_DATA_PARAMS params;
+  params.A = A_holder.data();
+  params.lda = K;
+  params.B = B_holder.data();
+  params.ldb = N;
+  params.C = C_holder.data();
+  params.ldc = N;
+  params.alpha = 1.0f;
+  params.beta = 0.0f;
+
+  // warm up so the first timed iteration doesn't pay the page faults
+  MlasGemm(CblasNoTrans, CblasNoTrans, M, N, K, params, tp.get());
+
+  for (auto _ : state) {
+    MlasGemm(CblasNoTrans, CblasNoTrans, M, N, K, params, tp.get());
+  }
+
+  const double flop_per_iteration = 2.0 * double(M) * double(N) * double(K);
+  const double bytes_per_iteration = sizeof(float) * (double(M) * K + double(K) * N + double(M) * N);
+
+  state.counters["GFLOPS"] = benchmark::Counter(
+      flop_per_iteration * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["Bytes"] = benchmark::Counter(
+      bytes_per_iteration, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  state.counters["FlopPerByte"] = benchmark::Counter(flop_per_iteration / bytes_per_iteration);
+}
+
+BENCHMARK(SGEMM_ROOFLINE)
+    ->ArgNames(sgemm_roofline_arg_names)
+    ->ArgsProduct({
+        {64, 256, 1024},  // M
+        {64, 256, 1024},  // N
+        {64, 256, 1024},  // K
+        {1, 8},           // Threads
+    })
+    ->UseRealTime();
@@ -0,0 +1,206 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+#include <cmath>
+#include <vector>
+
+// Validates MlasFlashAttention against a naive attention reference, including the
+// grouped-query path where kv_num_heads divides num_heads and consecutive query heads share
+// one K/V head.
+class MlasFlashAttentionGqaTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferQ;
+  MatrixGuardBuffer<float> BufferK;
+  MatrixGuardBuffer<float> BufferV;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+  MatrixGuardBuffer<float> BufferScratch;
+
+  // half-split rotary, matching the kernel's fused convention
+  static void RotateRows(std::vector<float>& rows, int row_count, int head_size, int rope_dim,
+                         int position_base, const std::vector<float>& cos_cache,
+                         const std::vector<float>& sin_cache) {
+    const int half = rope_dim / 2;
+    for (int row = 0; row < row_count; row++) {
+      float* r = rows.data() + static_cast<size_t>(row) * head_size;
+      const float* c = cos_cache.data() + static_cast<size_t>(position_base + row) * half;
+      const float* sn = sin_cache.data() + static_cast<size_t>(position_base + row) * half;
+      for (int d = 0; d < half; d++) {
+        const float x0 = r[d];
+        const float x1 = r[d + half];
+        r[d] = x0 * c[d] - x1 * sn[d];
+        r[d + half] = x0 * sn[d] + x1 * c[d];
+      }
+    }
+  }
+
+  void ComputeReference(const float* Q, const float* K, const float* V, float* Output,
+                        int batch_size, int num_heads, int kv_num_heads,
+                        int q_sequence_length, int kv_sequence_length,
+                        int qk_head_size, int v_head_size, float scale,
+                        int rope_dim, const std::vector<float>& cos_cache,
+                        const std::vector<float>& sin_cache) {
+    const int q_heads_per_kv_head = num_heads / kv_num_heads;
+    std::vector<float> scores(static_cast<size_t>(kv_sequence_length));
+
+    for (int b = 0; b < batch_size; b++) {
+      for (int h = 0; h < num_heads; h++) {
+        const int kv_h = h / q_heads_per_kv_head;
+        const float* q_head = Q + ((static_cast<size_t>(b) * num_heads + h) * q_sequence_length) * qk_head_size;
+        const float* k_head = K + ((static_cast<size_t>(b) * kv_num_heads + kv_h) * kv_sequence_length) * qk_head_size;
+        const float* v_head = V + ((static_cast<size_t>(b) * kv_num_heads + kv_h) * kv_sequence_length) * v_head_size;
+        float* out_head = Output + ((static_cast<size_t>(b) * num_heads + h) * q_sequence_length) * v_head_size;
+
+        std::vector<float> q_rows(q_head, q_head + static_cast<size_t>(q_sequence_length) * qk_head_size);
+        std::vector<float> k_rows(k_head, k_head + static_cast<size_t>(kv_sequence_length) * qk_head_size);
+        if (rope_dim > 0) {
+          RotateRows(q_rows, q_sequence_length, qk_head_size, rope_dim, 0, cos_cache, sin_cache);
+          RotateRows(k_rows, kv_sequence_length, qk_head_size, rope_dim, 0, cos_cache, sin_cache);
+        }
+
+        for (int q = 0; q < q_sequence_length; q++) {
+          const float* q_row = q_rows.data() + static_cast<size_t>(q) * qk_head_size;
+
+          float max_score = std::numeric_limits<float>::lowest();
+          for (int t = 0; t < kv_sequence_length; t++) {
+            const float* k_row = k_rows.data() + static_cast<size_t>(t) * qk_head_size;
+            float score = 0.0f;
+            for (int d = 0; d < qk_head_size; d++) {
+              score += q_row[d] * k_row[d];
+            }
+            scores[t] = score * scale;
+            max_score = std::max(max_score, scores[t]);
+          }
+
+          float sum = 0.0f;
+          for (int t = 0; t < kv_sequence_length; t++) {
+            scores[t] = std::exp(scores[t] - max_score);
+            sum += scores[t];
+          }
+
+          float* out_row = out_head + static_cast<size_t>(q) * v_head_size;
+          for (int d = 0; d < v_head_size; d++) {
+            float acc = 0.0f;
+            for (int t = 0; t < kv_sequence_length; t++) {
+              acc += scores[t] * v_head[static_cast<size_t>(t) * v_head_size + d];
+            }
+            out_row[d] = acc / sum;
+          }
+        }
+      }
+    }
+  }
+
+  void Test(int batch_size, int num_heads, int kv_num_heads,
+            int q_sequence_length, int kv_sequence_length,
+            int qk_head_size, int v_head_size,
+            int q_block_size, int kv_block_size,
+            int rope_dim = 0) {
+    const size_t q_elements =
+        static_cast<size_t>(batch_size) * num_heads * q_sequence_length * qk_head_size;
+    const size_t k_elements =
+        static_cast<size_t>(batch_size) * kv_num_heads * kv_sequence_length * qk_head_size;
+    const size_t v_elements =
+        static_cast<size_t>(batch_size) * kv_num_heads * kv_sequence_length * v_head_size;
+    const size_t out_elements =
+        static_cast<size_t>(batch_size) * num_heads * q_sequence_length * v_head_size;
+
+    const float* Q = BufferQ.GetBuffer(q_elements);
+    const float* K = BufferK.GetBuffer(k_elements);
+    const float* V = BufferV.GetBuffer(v_elements);
+    float* Output = BufferOutput.GetBuffer(out_elements);
+    float* OutputReference = BufferOutputReference.GetBuffer(out_elements);
+
+    const float scale = 1.0f / std::sqrt(static_cast<float>(qk_head_size));
+
+    // rotary caches for the larger of the two sequence lengths
+    const int half = rope_dim / 2;
+    const int max_position = std::max(q_sequence_length, kv_sequence_length);
+    std::vector<float> cos_cache(static_cast<size_t>(max_position) * half);
+    std::vector<float> sin_cache(static_cast<size_t>(max_position) * half);
+    for (int p = 0; p < max_position; p++) {
+      for (int d = 0; d < half; d++) {
+        const float angle = static_cast<float>(p) / std::pow(10000.0f, 2.0f * d / rope_dim);
+        cos_cache[static_cast<size_t>(p) * half + d] = std::cos(angle);
+        sin_cache[static_cast<size_t>(p) * half + d] = std::sin(angle);
+      }
+    }
+
+    ComputeReference(Q, K, V, OutputReference, batch_size, num_heads, kv_num_heads,
+                     q_sequence_length, kv_sequence_length, qk_head_size, v_head_size, scale,
+                     rope_dim, cos_cache, sin_cache);
+
+    MlasFlashAttentionThreadedArgs args;
+    args.batch_size = batch_size;
+    args.num_heads = num_heads;
+    args.kv_num_heads = kv_num_heads;
+    args.q_sequence_length = q_sequence_length;
+    args.kv_sequence_length = kv_sequence_length;
+    args.qk_head_size = qk_head_size;
+    args.v_head_size = v_head_size;
+    args.q_block_size = q_block_size;
+    args.kv_block_size = kv_block_size;
+    args.scale = scale;
+    args.thread_count = onnxruntime::concurrency::ThreadPool::DegreeOfParallelism(GetMlasThreadPool());
+    if (rope_dim > 0) {
+      args.rope_cos = cos_cache.data();
+      args.rope_sin = sin_cache.data();
+      args.rope_dim = rope_dim;
+    }
+    // per-thread scratch layout matches the MultiHeadAttention caller: l, m, the score block
+    // and the temporary output, plus the rotated Q/K blocks when rope is fused
+    args.buffer_size_per_thread = (static_cast<size_t>(q_block_size) * 2 +
+                                   static_cast<size_t>(q_block_size) * kv_block_size +
+                                   static_cast<size_t>(q_block_size) * v_head_size) *
+                                  sizeof(float);
+    if (rope_dim > 0) {
+      args.buffer_size_per_thread +=
+          (static_cast<size_t>(q_block_size) + kv_block_size) * qk_head_size * sizeof(float);
+    }
+    float* scratch = BufferScratch.GetBuffer(args.buffer_size_per_thread / sizeof(float) *
+                                             static_cast<size_t>(args.thread_count));
+    args.buffer = scratch;
+    args.query = Q;
+    args.key = K;
+    args.value = V;
+    args.output = Output;
+
+    MlasFlashAttention(&args, GetMlasThreadPool());
+
+    for (size_t i = 0; i < out_elements; i++) {
+      ASSERT_NEAR(Output[i], OutputReference[i], 1e-4f)
+          << " batch=" << batch_size << " heads=" << num_heads << "/" << kv_num_heads
+          << " q_len=" << q_sequence_length << " kv_len=" << kv_sequence_length
+          << " index=" << i;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    return "FlashAttentionGqa";
+  }
+
+  void ExecuteShort(void) override {
+    // multi-head baseline (kv_num_heads == num_heads) stays intact
+    Test(1, 4, 4, 8, 8, 16, 16, 4, 4);
+    Test(2, 2, 2, 13, 17, 8, 8, 5, 7);
+    // grouped-query: 4 query heads per K/V head, including ragged block sizes
+    Test(1, 8, 2, 8, 8, 16, 16, 4, 4);
+    Test(2, 4, 2, 13, 17, 8, 12, 5, 7);
+    Test(1, 6, 3, 9, 21, 12, 8, 3, 8);
+    // fused rotary embedding: full-dim and partial-dim rotation, with and without GQA
+    Test(1, 4, 4, 8, 8, 16, 16, 4, 4, /*rope_dim*/ 16);
+    Test(2, 4, 2, 13, 17, 8, 12, 5, 7, /*rope_dim*/ 8);
+    Test(1, 6, 3, 9, 21, 12, 8, 3, 8, /*rope_dim*/ 6);
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasFlashAttentionGqaTest>::RegisterShortExecute();
+  }
+  return count;
+});
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <typename QuantInt>
+class MlasQuantizeLinearReluTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<QuantInt> BufferOutput;
+  MatrixGuardBuffer<QuantInt> BufferOutputReference;
+
+  // reference = ReLU followed by the regular quantize kernel
+  void GenerateReference(const float* Input, QuantInt* OutputReference, size_t N, float Scale,
+                         QuantInt ZeroPoint) {
+    for (size_t n = 0; n < N; n++) {
+      float FloatValue = std::nearbyintf(std::max(Input[n], 0.0f) / Scale) + float(ZeroPoint);
+      FloatValue = std::max(FloatValue, static_cast<float>(std::numeric_limits<QuantInt>::min()));
+      FloatValue = std::min(FloatValue, static_cast<float>(std::numeric_limits<QuantInt>::max()));
+      OutputReference[n] = static_cast<QuantInt>(FloatValue);
+    }
+  }
+
+  void Test(size_t N) {
+    float* Input = BufferInput.GetBuffer(N);
+    QuantInt* Output = BufferOutput.GetBuffer(N);
+    QuantInt* OutputReference = BufferOutputReference.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+
+    std::uniform_real_distribution<float> min_gen(-10.f, -10e-3f);
+    float MinimumValue = min_gen(generator);
+
+    std::uniform_real_distribution<float> max_gen(10e-3f, 10.f);
+    float MaximumValue = max_gen(generator);
+
+    float Scale = (MaximumValue - MinimumValue) / 512.f;
+
+    std::uniform_int_distribution<int32_t> zp_distribution(std::numeric_limits<QuantInt>::min(),
+                                                           std::numeric_limits<QuantInt>::max());
+    QuantInt ZeroPoint = static_cast<QuantInt>(zp_distribution(generator));
+
+    // span negative and positive inputs so the fused ReLU clamp is exercised on both sides
+    std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+    for (size_t n = 0; n < N; n++) {
+      Input[n] = distribution(generator);
+    }
+
+    GenerateReference(Input, OutputReference, N, Scale, ZeroPoint);
+    MlasQuantizeLinearRelu(Input, Output, N, Scale, ZeroPoint);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Output[n], OutputReference[n]) << ", size=" << N << ", index=" << n
+                                               << ", input=" << Input[n];
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    if constexpr (std::is_same_v<QuantInt, int8_t>) {
+      return "QuantizeLinearReluS8";
+    } else {
+      return "QuantizeLinearReluU8";
+    }
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t n = 1; n <= 512; n++) {
+      Test(n);
+    }
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasQuantizeLinearReluTest<int8_t>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasQuantizeLinearReluTest<uint8_t>>::RegisterShortExecute();
+  }
+  return count;
+});
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasGemmPackBThreadedTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<uint8_t> BufferPacked;
+  MatrixGuardBuffer<uint8_t> BufferPackedReference;
+
+  void Test(CBLAS_TRANSPOSE TransB, size_t N, size_t K) {
+    const size_t ldb = (TransB == CblasNoTrans) ? N : K;
+    const float* B = BufferB.GetBuffer(N * K);
+
+    const size_t PackedBSize = MlasGemmPackBSize(N, K);
+    ASSERT_NE(PackedBSize, size_t(0));
+
+    uint8_t* PackedB = BufferPacked.GetBuffer(PackedBSize);
+    uint8_t* PackedBReference = BufferPackedReference.GetBuffer(PackedBSize);
+
+    // pad bytes inside the packed buffer are not written by either path; give both buffers the
+    // same initial contents so a byte compare only sees real differences
+    std::fill_n(PackedB, PackedBSize, uint8_t(0xa5));
+    std::fill_n(PackedBReference, PackedBSize, uint8_t(0xa5));
+
+    MlasGemmPackB(TransB, N, K, B, ldb, PackedBReference);
+    MlasGemmPackB(TransB, N, K, B, ldb, PackedB, GetMlasThreadPool());
+
+    // the threaded overload must produce a byte-identical layout
+    ASSERT_EQ(std::memcmp(PackedB, PackedBReference, PackedBSize), 0)
+        << " TransB=" << (TransB == CblasNoTrans ? "N" : "T") << " N=" << N << " K=" << K;
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    return "SgemmPackBThreaded";
+  }
+
+  void ExecuteShort(void) override {
+    for (CBLAS_TRANSPOSE trans : {CblasNoTrans, CblasTrans}) {
+      // cover fewer rows than one K chunk, an exact chunk multiple, and ragged tails on both
+      // dimensions so partial chunks and uneven N panels both get exercised
+      Test(trans, 16, 16);
+      Test(trans, 32, 128);
+      Test(trans, 48, 256);
+      Test(trans, 65, 129);
+      Test(trans, 31, 384);
+      Test(trans, 128, 1000);
+    }
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasGemmPackBThreadedTest>::RegisterShortExecute();
+  }
+  return count;
+});
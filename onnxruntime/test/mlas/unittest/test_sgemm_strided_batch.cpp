@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasGemmStridedBatchTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+
+  void Test(size_t M, size_t N, size_t K, size_t BatchSize, bool BroadcastB,
+            float alpha, float beta) {
+    const size_t StrideA = M * K;
+    const size_t StrideB = BroadcastB ? 0 : K * N;
+    const size_t StrideC = M * N;
+
+    const float* A = BufferA.GetBuffer(StrideA * BatchSize);
+    const float* B = BufferB.GetBuffer(K * N * (BroadcastB ? 1 : BatchSize));
+    float* C = BufferC.GetBuffer(StrideC * BatchSize);
+    float* CReference = BufferCReference.GetBuffer(StrideC * BatchSize);
+
+    std::fill_n(C, StrideC * BatchSize, -0.5f);
+    std::fill_n(CReference, StrideC * BatchSize, -0.5f);
+
+    // reference: one MlasGemm per matrix over the same data
+    for (size_t b = 0; b < BatchSize; b++) {
+      MLAS_SGEMM_DATA_PARAMS params;
+      params.A = A + b * StrideA;
+      params.lda = K;
+      params.B = B + b * StrideB;
+      params.ldb = N;
+      params.C = CReference + b * StrideC;
+      params.ldc = N;
+      params.alpha = alpha;
+      params.beta = beta;
+      MlasGemm(CblasNoTrans, CblasNoTrans, M, N, K, params, GetMlasThreadPool());
+    }
+
+    MlasGemmStridedBatch(CblasNoTrans, CblasNoTrans, M, N, K,
+                         alpha, A, K, StrideA, B, N, StrideB, beta, C, N, StrideC,
+                         BatchSize, GetMlasThreadPool());
+
+    for (size_t i = 0; i < StrideC * BatchSize; i++) {
+      ASSERT_EQ(C[i], CReference[i]) << " M=" << M << " N=" << N << " K=" << K
+                                     << " batch=" << BatchSize << " broadcast=" << BroadcastB
+                                     << " index=" << i;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    return "SgemmStridedBatch";
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t batch : {1, 2, 5}) {
+      for (bool broadcast_b : {false, true}) {
+        Test(1, 32, 16, batch, broadcast_b, 1.0f, 0.0f);
+        Test(17, 19, 23, batch, broadcast_b, 1.0f, 0.0f);
+        Test(32, 32, 32, batch, broadcast_b, 0.5f, 1.0f);
+        Test(64, 48, 80, batch, broadcast_b, 1.0f, 0.0f);
+      }
+    }
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasGemmStridedBatchTest>::RegisterShortExecute();
+  }
+  return count;
+});
@@ -3173,14 +3173,19 @@ TEST(QDQTransformerTests, ReluQuantFusion_Level2Only) {
     auto check_relu_graph = [&](InferenceSessionWrapper& session) {
       auto op_to_count = CountOpsInGraph(session.GetGraph());
       const QDQOpKeys qdq_keys = GetQDQOpKeys(false);
-      // Only fuse relu into Q if level >= 2 and zero_point == -128 for int8.
-      // Level1 graph:   input -> DQ -> Relu -> Q -> DQ -> output
-      // Level2+ graph: input -> DQ -> output (QuantReluFusion + QDQFinalCleanupTransformer transformers)
-      const bool fuse_relu = (zp == -128) &&
-                             (opt_level == TransformerLevel::Level2 || opt_level == TransformerLevel::Level3);
-      EXPECT_EQ(op_to_count[qdq_keys.quantize_linear], fuse_relu ? 0 : 1);
-      EXPECT_EQ(op_to_count["Relu"], fuse_relu ? 0 : 1);
-      EXPECT_EQ(op_to_count[qdq_keys.dequantize_linear], fuse_relu ? 1 : 2);
+      // At level >= 2 the Relu is dropped outright when zero_point == -128 for int8 (the Q
+      // node already saturates there), and otherwise folded into the contrib QuantizeLinear
+      // via its fuse_relu attribute.
+      // Level1 graph:            input -> DQ -> Relu -> Q -> DQ -> output
+      // Level2+, zp == -128:     input -> DQ -> output (ReluQuantFusion + QDQFinalCleanupTransformer)
+      // Level2+, zp != -128:     input -> DQ -> com.microsoft.Q(fuse_relu) -> DQ -> output
+      const bool level2_plus = opt_level == TransformerLevel::Level2 || opt_level == TransformerLevel::Level3;
+      const bool relu_dropped = (zp == -128) && level2_plus;
+      const bool relu_folded = (zp != -128) && level2_plus;
+      EXPECT_EQ(op_to_count[qdq_keys.quantize_linear], (relu_dropped || relu_folded) ? 0 : 1);
+      EXPECT_EQ(op_to_count["com.microsoft.QuantizeLinear"], relu_folded ? 1 : 0);
+      EXPECT_EQ(op_to_count["Relu"], (relu_dropped || relu_folded) ? 0 : 1);
+      EXPECT_EQ(op_to_count[qdq_keys.dequantize_linear], relu_dropped ? 1 : 2);
     };
 
     constexpr float epsilon = std::numeric_limits<float>::epsilon();
@@ -3196,7 +3201,7 @@ TEST(QDQTransformerTests, ReluQuantFusion_Level2Only) {
   test_case(TransformerLevel::Level1, -128);  // Will not fuse Relu into QuantizeLinear due to level1 opt.
   test_case(TransformerLevel::Level2, -128);  // Will fuse Relu into QuantizeLinear.
   test_case(TransformerLevel::Level3, -128);  // Will fuse Relu into QuantizeLinear.
-  test_case(TransformerLevel::Level3, 0);     // Will not fuse Relu into QuantizeLinear due to zero-point != -128
+  test_case(TransformerLevel::Level3, 0);     // zero-point != -128: Relu folds into contrib QuantizeLinear (fuse_relu)
 }
 
 TEST(QDQTransformerTests, Concat) {